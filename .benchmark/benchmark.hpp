@@ -0,0 +1,77 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 19.02.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+struct Benchmark
+{
+    struct Result
+    {
+        std::string name;
+        size_t n_operations;
+        std::chrono::duration<double> duration;
+    };
+
+    static inline std::vector<Result> _results = {};
+    static inline const void* volatile _sink = nullptr;
+
+    /// @brief run lambda and record how many operations per second it achieved
+    /// @param name: name of the benchmark
+    /// @param n_operations: number of operations lambda performs
+    /// @param lambda
+    /// @param n_repeats: number of timed runs, the median duration is recorded
+    /// @param n_warm_up: number of untimed runs before the first timed one, so julia compiles the called methods first
+    template<typename Lambda_t>
+    static void run(const std::string& name, size_t n_operations, Lambda_t&& lambda, size_t n_repeats = 1, size_t n_warm_up = 0)
+    {
+        std::cout << name << ": " << std::flush;
+
+        for (size_t i = 0; i < n_warm_up; ++i)
+            lambda();
+
+        std::vector<std::chrono::duration<double>> durations;
+        for (size_t i = 0; i < n_repeats; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            lambda();
+            durations.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start));
+        }
+
+        std::sort(durations.begin(), durations.end());
+        auto duration = durations.at(durations.size() / 2);
+
+        _results.push_back({name, n_operations, duration});
+        std::cout << std::fixed << std::setprecision(0) << n_operations / duration.count() << " op/s" << std::endl;
+    }
+
+    /// @brief prevent the compiler from discarding a result that is otherwise unused
+    /// @param value
+    template<typename T>
+    static void keep_alive(const T& value)
+    {
+        _sink = &value;
+        asm volatile("" : : "r"(&value) : "memory");
+    }
+
+    static void conclude()
+    {
+        std::cout << std::endl;
+        std::cout << "Number of benchmarks run: " << _results.size() << std::endl;
+
+        for (auto& result : _results)
+        {
+            std::cout << "| " << std::left << std::setw(40) << result.name
+                      << std::right << std::setw(15) << std::setprecision(0) << result.n_operations / result.duration.count() << " op/s"
+                      << std::setw(12) << std::setprecision(3) << result.duration.count() << " s\n";
+        }
+    }
+};
@@ -0,0 +1,165 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 19.02.22 by clem (mail@clemens-cords.com)
+//
+
+#include <jluna.hpp>
+#include <thread>
+#include <.benchmark/benchmark.hpp>
+
+using namespace jluna;
+
+int main()
+{
+    State::initialize();
+
+    static const size_t n_calls = 100000;
+    auto* sum = jl_get_function(jl_base_module, "sum");
+
+    // throughput vs. number of threads, every thread calls julia directly
+    for (size_t n_threads : {1, 2, 4, 8, 16, 32})
+    {
+        Benchmark::run("safe_call: " + std::to_string(n_threads) + " threads", n_calls, [&](){
+
+            std::vector<std::thread> workers;
+            for (size_t i = 0; i < n_threads; ++i)
+                workers.emplace_back([&](){
+
+                    State::adopt_thread();
+
+                    auto vec = State::safe_script("return [1, 2, 3, 4]");
+                    for (size_t j = 0; j < n_calls / n_threads; ++j)
+                        safe_call(sum, (jl_value_t*) vec);
+                });
+
+            GCSafeRegion region;
+            for (auto& worker : workers)
+                worker.join();
+        });
+    }
+
+    // same, but every result is held by a proxy, stresses the reference table
+    for (size_t n_threads : {1, 2, 4, 8, 16, 32})
+    {
+        Benchmark::run("proxy: " + std::to_string(n_threads) + " threads", n_calls, [&](){
+
+            std::vector<std::thread> workers;
+            for (size_t i = 0; i < n_threads; ++i)
+                workers.emplace_back([&](){
+
+                    State::adopt_thread();
+
+                    auto proxy = Main["Base"]["sum"];
+                    for (size_t j = 0; j < n_calls / n_threads; ++j)
+                        auto result = proxy(std::vector<size_t>{1, 2, 3, 4});
+                });
+
+            GCSafeRegion region;
+            for (auto& worker : workers)
+                worker.join();
+        });
+    }
+
+    // messages per second from a C++ thread to a julia consumer, isbits values are never boxed
+    static const size_t n_messages = 10000000;
+    for (size_t capacity : {64, 1024, 16384})
+    {
+        auto channel = Channel<Int64>(capacity);
+        auto* sum = jl_get_function(jl_base_module, "sum");
+
+        Benchmark::run("channel: capacity " + std::to_string(capacity), n_messages, [&](){
+
+            std::thread producer([&](){
+                for (size_t i = 0; i < n_messages; ++i)
+                    channel.push(i);
+
+                channel.close();
+            });
+
+            safe_call(sum, (jl_value_t*) channel);
+            producer.join();
+        });
+    }
+
+    // jluna::numeric against the equivalent julia function called from C++. Each side is run once untimed, so julia compiles the method before it is measured
+    static const size_t n_elements = 10000000;
+    static const size_t n_repeats = 10;
+    {
+        State::safe_script("import Random, LinearAlgebra");
+
+        auto array = Array<Float64, 1>(State::safe_script("return rand(" + std::to_string(n_elements) + ")"));
+        auto other = Array<Float64, 1>(State::safe_script("return rand(" + std::to_string(n_elements) + ")"));
+        auto unsorted = Array<Float64, 1>(State::safe_script("return rand(" + std::to_string(n_elements) + ")"));
+        auto narrow = Array<Float32, 1>(State::safe_script("return zeros(Float32, " + std::to_string(n_elements) + ")"));
+
+        auto* julia_sum = jl_get_function(jl_base_module, "sum");
+        auto* julia_extrema = jl_get_function(jl_base_module, "extrema");
+        auto* julia_dot = (jl_function_t*) jl_eval_string("return LinearAlgebra.dot");
+        auto* julia_fill = jl_get_function(jl_base_module, "fill!");
+        auto* julia_map = jl_get_function(jl_base_module, "map!");
+        auto* julia_abs2 = jl_get_function(jl_base_module, "abs2");
+        auto* julia_copyto = jl_get_function(jl_base_module, "copyto!");
+        auto* julia_sort = jl_get_function(jl_base_module, "sort!");
+
+        Benchmark::run("numeric::sum", n_elements, [&](){
+            Benchmark::keep_alive(numeric::sum(array));
+        }, n_repeats, 1);
+
+        Benchmark::run("Base.sum", n_elements, [&](){
+            Benchmark::keep_alive(safe_call(julia_sum, (jl_value_t*) array));
+        }, n_repeats, 1);
+
+        Benchmark::run("numeric::minmax", n_elements, [&](){
+            Benchmark::keep_alive(numeric::minmax(array));
+        }, n_repeats, 1);
+
+        Benchmark::run("Base.extrema", n_elements, [&](){
+            Benchmark::keep_alive(safe_call(julia_extrema, (jl_value_t*) array));
+        }, n_repeats, 1);
+
+        Benchmark::run("numeric::dot", n_elements, [&](){
+            Benchmark::keep_alive(numeric::dot(array, other));
+        }, n_repeats, 1);
+
+        Benchmark::run("LinearAlgebra.dot", n_elements, [&](){
+            Benchmark::keep_alive(safe_call(julia_dot, (jl_value_t*) array, (jl_value_t*) other));
+        }, n_repeats, 1);
+
+        Benchmark::run("numeric::transform", n_elements, [&](){
+            numeric::transform(array, other, [](Float64 x) -> Float64 { return x * x; });
+        }, n_repeats, 1);
+
+        Benchmark::run("Base.map!", n_elements, [&](){
+            safe_call(julia_map, julia_abs2, (jl_value_t*) other, (jl_value_t*) array);
+        }, n_repeats, 1);
+
+        Benchmark::run("numeric::convert", n_elements, [&](){
+            numeric::convert(array, narrow);
+        }, n_repeats, 1);
+
+        Benchmark::run("Base.copyto!", n_elements, [&](){
+            safe_call(julia_copyto, (jl_value_t*) narrow, (jl_value_t*) array);
+        }, n_repeats, 1);
+
+        Benchmark::run("numeric::fill", n_elements, [&](){
+            numeric::fill(array, 1.0);
+        }, n_repeats, 1);
+
+        Benchmark::run("Base.fill!", n_elements, [&](){
+            safe_call(julia_fill, (jl_value_t*) array, jl_box_float64(1.0));
+        }, n_repeats, 1);
+
+        // every run sorts the same unsorted data, copying it in is part of the measurement on both sides
+        Benchmark::run("numeric::sort", n_elements, [&](){
+            std::copy(unsorted.data(), unsorted.data() + n_elements, array.data());
+            numeric::sort(array);
+        }, n_repeats, 1);
+
+        Benchmark::run("Base.sort!", n_elements, [&](){
+            std::copy(unsorted.data(), unsorted.data() + n_elements, array.data());
+            safe_call(julia_sort, (jl_value_t*) array);
+        }, n_repeats, 1);
+    }
+
+    Benchmark::conclude();
+}
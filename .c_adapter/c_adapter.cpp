@@ -10,12 +10,19 @@ extern "C"
     {
         void call_function(size_t id)
         {
-            static jl_function_t* get_args = jl_get_function((jl_module_t*) jl_eval_string("return Main._cppcall"), "get_arguments");
-            static jl_function_t* set_result = jl_get_function((jl_module_t*) jl_eval_string("return Main._cppcall"), "set_result");
+            jl_function_t* get_args = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return Main._cppcall"), "get_arguments"); });
+            jl_function_t* set_result = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return Main._cppcall"), "set_result"); });
             jl_value_t* tuple = jl_call0(get_args);
             jl_value_t* res;
 
-            res = _functions.at(id).first(tuple);
+            // copied so the lambda may (un)register functions and other threads may do so while it runs
+            std::function<jl_value_t*(jl_value_t*)> function;
+            {
+                std::shared_lock<std::shared_mutex> lock(_function_lock);
+                function = _functions.at(id).first;
+            }
+
+            res = function(tuple);
 
             if (res == nullptr) // catch returning nullptr
                 res = jl_nothing;
@@ -25,7 +32,7 @@ extern "C"
 
         size_t hash(const std::string& str)
         {
-            static jl_function_t* hash = jl_get_function(jl_base_module, "hash");
+            jl_function_t* hash = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "hash"); });
             return jl_unbox_uint64(jl_call1(hash, (jl_value_t*) jl_symbol(str.data())));
         }
 
@@ -38,30 +45,122 @@ extern "C"
                 throw std::invalid_argument(str.c_str());
             }
 
-            _functions.insert({hash(name), std::make_pair(lambda, n_args)});
+            auto id = hash(name);
+
+            std::unique_lock<std::shared_mutex> lock(_function_lock);
+            _functions.insert({id, std::make_pair(lambda, n_args)});
         }
 
         void unregister_function(const std::string& name)
         {
-            _functions.erase(hash(name));
+            auto id = hash(name);
+
+            std::unique_lock<std::shared_mutex> lock(_function_lock);
+            _functions.erase(id);
         }
 
         bool is_registered(size_t id)
         {
+            std::shared_lock<std::shared_mutex> lock(_function_lock);
             auto it = _functions.find(id);
             return it != _functions.end();
         }
 
         size_t get_n_args(size_t id)
         {
+            std::shared_lock<std::shared_mutex> lock(_function_lock);
             return _functions.at(id).second;
         }
 
         void free_function(size_t id)
         {
             std::cout << "freed unnamed function with id #" << id << std::endl;
+
+            std::unique_lock<std::shared_mutex> lock(_function_lock);
             _functions.erase(id);
         }
+
+        size_t register_callback(std::function<void(jl_value_t*)>&& callback)
+        {
+            size_t id = ++_callback_id;
+
+            std::lock_guard<std::mutex> guard(_callback_lock);
+            _callbacks.insert({id, std::move(callback)});
+            return id;
+        }
+
+        void unregister_callback(size_t id)
+        {
+            std::lock_guard<std::mutex> guard(_callback_lock);
+            _callbacks.erase(id);
+        }
+
+        void invoke_callback(size_t id, jl_value_t* result)
+        {
+            std::function<void(jl_value_t*)> callback;
+            {
+                std::lock_guard<std::mutex> guard(_callback_lock);
+                auto it = _callbacks.find(id);
+
+                if (it == _callbacks.end())
+                    return;
+
+                callback = std::move(it->second);
+                _callbacks.erase(it);
+            }
+
+            callback(result);
+        }
+
+        size_t register_generator(std::function<size_t(jl_value_t*)>&& generator)
+        {
+            size_t id = ++_generator_id;
+
+            std::lock_guard<std::mutex> guard(_generator_lock);
+            _generators.insert({id, std::make_shared<std::function<size_t(jl_value_t*)>>(std::move(generator))});
+            return id;
+        }
+
+        void unregister_generator(size_t id)
+        {
+            std::lock_guard<std::mutex> guard(_generator_lock);
+            _generators.erase(id);
+        }
+
+        size_t invoke_generator(size_t id, jl_value_t* buffer)
+        {
+            // shared instead of copied, generators are stateful
+            std::shared_ptr<std::function<size_t(jl_value_t*)>> generator;
+            {
+                std::lock_guard<std::mutex> guard(_generator_lock);
+                auto it = _generators.find(id);
+
+                if (it == _generators.end())
+                    return 0;
+
+                generator = it->second;
+            }
+
+            try
+            {
+                return (*generator)(buffer);
+            }
+            catch (const std::exception& e)
+            {
+                _generator_error = e.what();
+            }
+            catch (...)
+            {
+                _generator_error = "unknown exception";
+            }
+
+            return SIZE_MAX;
+        }
+
+        const char* get_generator_error()
+        {
+            return _generator_error.c_str();
+        }
     }
 }
 
@@ -11,16 +11,22 @@
 
 #include <map>
 #include <julia.h>
+#include <typedefs.hpp>
 #include <functional>
 #include <string>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <memory>
 
 extern "C"
 {
     /// @brief c-compatible interface, only intended for internal use
     namespace jluna::c_adapter
     {
-        /// @brief holds lambda registers via jluna
+        /// @brief holds lambda registers via jluna, guarded by _function_lock
         static inline std::map<size_t, std::pair<std::function<jl_value_t*(jl_value_t*)>, size_t>> _functions = {};
+        static inline std::shared_mutex _function_lock;
 
         /// @brief hash lambda-side
         size_t hash(const std::string&);
@@ -42,6 +48,43 @@ extern "C"
 
         /// @brief free function
         void free_function(size_t);
+
+        /// @brief holds callbacks waiting for a julia-side task to finish, guarded by _callback_lock
+        static inline std::map<size_t, std::function<void(jl_value_t*)>> _callbacks = {};
+        static inline std::mutex _callback_lock;
+        static inline std::atomic<size_t> _callback_id = 0;
+
+        /// @brief add callback to callback register
+        /// @returns id to be handed to julia
+        size_t register_callback(std::function<void(jl_value_t*)>&&);
+
+        /// @brief remove callback from callback register without invoking it
+        void unregister_callback(size_t id);
+
+        /// @brief invoke callback by id then remove it, may be called from any thread
+        void invoke_callback(size_t id, jl_value_t*);
+
+        /// @brief holds generators filling julia-side buffers, guarded by _generator_lock
+        static inline std::map<size_t, std::shared_ptr<std::function<size_t(jl_value_t*)>>> _generators = {};
+        static inline std::mutex _generator_lock;
+        static inline std::atomic<size_t> _generator_id = 0;
+
+        /// @brief message of the last exception thrown by a generator on this thread
+        static inline thread_local std::string _generator_error;
+
+        /// @brief add generator to generator register
+        /// @returns id to be handed to julia
+        size_t register_generator(std::function<size_t(jl_value_t*)>&&);
+
+        /// @brief remove generator from generator register, julia-side iteration ends on the next call
+        void unregister_generator(size_t id);
+
+        /// @brief fill buffer using generator by id
+        /// @returns number of elements written, 0 if the generator is exhausted or was unregistered, SIZE_MAX if it threw an exception
+        size_t invoke_generator(size_t id, jl_value_t* buffer);
+
+        /// @brief get message of the last exception thrown by a generator on this thread
+        const char* get_generator_error();
     }
 }
 
@@ -52,5 +95,8 @@ void call_function(size_t);
 bool is_registered(size_t);
 void throw_undefined_symbol(const char*);
 size_t get_n_args(size_t);
+void invoke_callback(size_t, void*);
+size_t invoke_generator(size_t, void*);
+const char* get_generator_error();
 
 #endif
\ No newline at end of file
@@ -9,7 +9,18 @@ module _cppcall
     end
 
     const _library_name = "@RESOURCE_PATH@/libjluna_c_adapter.so"
-    _state = Base.Ref{_cppcall.State}(State())
+
+    """
+    `get_state() -> State`
+
+    access _cppcall state, each task has its own so cppcall may be used from multiple threads at once
+    """
+    function get_state() ::State
+
+        return get!(task_local_storage(), :jluna_cppcall_state) do
+            State()
+        end
+    end
 
     """
     Wrapper object for unnamed functions, frees function once object is destroyed
@@ -67,7 +78,7 @@ module _cppcall
     """
     function set_result(x::Any) ::Nothing
 
-        global _cppcall._state[]._result = x
+        get_state()._result = x
         return nothing
     end
     
@@ -78,7 +89,7 @@ module _cppcall
     """
     function get_result() ::Any
 
-        return _cppcall._state[]._result
+        return get_state()._result
     end
     
     """
@@ -88,7 +99,7 @@ module _cppcall
     """
     function set_arguments(xs...) ::Nothing
 
-        global _cppcall._state[]._arguments = xs
+        get_state()._arguments = xs
         return nothing
     end
     
@@ -99,7 +110,7 @@ module _cppcall
     """
     function get_arguments() ::Tuple
 
-        return _cppcall._state[]._arguments
+        return get_state()._arguments
     end
 
     """
@@ -128,7 +139,7 @@ Call a lambda registered via `jluna::State::register_function` using `xs...` as
 After the C++-side function returns, return the resulting object
 (or `nothing` if the C++ function returns `void`)
 
-This function is not thread-safe and should not be used in a parallel context
+This function is thread-safe as long as the C++ function itself is
 """
 function cppcall(function_name::Symbol, xs...) ::Any
 
@@ -0,0 +1,120 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 28.02.22 by clem (mail@clemens-cords.com)
+//
+
+#include <mutex>
+#include <unordered_map>
+
+#include <.src/common.hpp>
+
+namespace jluna
+{
+    namespace detail
+    {
+        /// @brief deleters of adopted arrays, indexed by array
+        inline std::mutex _adopted_lock;
+        inline std::unordered_map<jl_value_t*, std::function<void()>> _adopted_deleters;
+
+        /// @brief julia-side finalizer of adopted arrays, called with the array itself
+        void finalize_adopted(void* array)
+        {
+            std::function<void()> deleter;
+            {
+                auto lock = std::lock_guard(_adopted_lock);
+                auto it = _adopted_deleters.find((jl_value_t*) array);
+
+                if (it == _adopted_deleters.end())
+                    return;
+
+                deleter = std::move(it->second);
+                _adopted_deleters.erase(it);
+            }
+
+            deleter();
+        }
+
+        /// @brief call deleter once array is garbage collected
+        void register_deleter(jl_value_t* array, std::function<void()>&& deleter)
+        {
+            {
+                // no julia allocations while holding the lock, a collection could run finalize_adopted on this thread
+                auto lock = std::lock_guard(_adopted_lock);
+                _adopted_deleters.insert({array, std::move(deleter)});
+            }
+
+            jl_gc_add_ptr_finalizer(jl_current_task->ptls, array, (void*) &finalize_adopted);
+        }
+
+        /// @brief wrap memory as julia-side array that does not own its buffer, unrooted
+        template<IsJuliaBits Value_t, size_t Rank>
+        jl_value_t* ptr_to_array(Value_t* data, const std::array<size_t, Rank>& dims)
+        {
+            auto* array_type = jl_apply_array_type((jl_value_t*) to_julia_type<Value_t>(), Rank);
+
+            if constexpr (Rank == 1)
+                return (jl_value_t*) jl_ptr_to_array_1d(array_type, data, dims.at(0), 0);
+            else
+            {
+                jl_function_t* tuple = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_core_module, "tuple"); });
+
+                std::array<jl_value_t*, Rank> boxed;
+                for (size_t i = 0; i < Rank; ++i)
+                    boxed[i] = jl_box_int64(dims[i]);
+
+                return (jl_value_t*) jl_ptr_to_array(array_type, data, jl_call(tuple, boxed.data(), Rank), 0);
+            }
+        }
+    }
+
+    template<IsJuliaBits Value_t, size_t Rank, typename Deleter_t>
+        requires std::is_invocable_v<Deleter_t, Value_t*>
+    Array<Value_t, Rank> adopt(Value_t* data, const std::array<size_t, Rank>& dims, Deleter_t deleter)
+    {
+        THROW_IF_UNINITIALIZED;
+
+        auto before = jl_gc_is_enabled();
+        jl_gc_enable(false);
+
+        auto* array = detail::ptr_to_array(data, dims);
+        detail::register_deleter(array, [data, deleter = std::move(deleter)]() mutable {
+            deleter(data);
+        });
+
+        auto out = Array<Value_t, Rank>(array);
+        jl_gc_enable(before);
+        return out;
+    }
+
+    template<IsJuliaBits Value_t, size_t Rank>
+    Array<Value_t, Rank> borrow(Value_t* data, const std::array<size_t, Rank>& dims)
+    {
+        THROW_IF_UNINITIALIZED;
+
+        auto before = jl_gc_is_enabled();
+        jl_gc_enable(false);
+
+        auto out = Array<Value_t, Rank>(detail::ptr_to_array(data, dims));
+        jl_gc_enable(before);
+        return out;
+    }
+
+    template<IsJuliaBits T> requires (not std::is_same_v<T, Bool>)
+    jl_value_t* box(std::vector<T>&& vector)
+    {
+        if (vector.empty())
+            return (jl_value_t*) jl_alloc_array_1d(jl_apply_array_type((jl_value_t*) to_julia_type<T>(), 1), 0);
+
+        auto before = jl_gc_is_enabled();
+        jl_gc_enable(false);
+
+        auto* owner = new std::vector<T>(std::move(vector));
+        auto* array = detail::ptr_to_array<T, 1>(owner->data(), {owner->size()});
+        detail::register_deleter(array, [owner]() {
+            delete owner;
+        });
+
+        jl_gc_enable(before);
+        return array;
+    }
+}
@@ -0,0 +1,69 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 01.03.22 by clem (mail@clemens-cords.com)
+//
+
+#include <new>
+
+#include <.src/common.hpp>
+
+namespace jluna
+{
+    template<IsJuliaBits T>
+    template<IsJuliaBits U>
+    allocator<T>::allocator(const allocator<U>&) noexcept
+    {}
+
+    template<IsJuliaBits T>
+    T* allocator<T>::allocate(size_t n)
+    {
+        THROW_IF_UNINITIALIZED;
+
+        if (n == 0)
+            return nullptr;
+
+        jl_function_t* allocate = detail::cached([&]() -> jl_function_t* { return get_function("jluna.memory_handler", "allocate"); });
+
+        jl_value_t* ptr = jl_call2(allocate, (jl_value_t*) to_julia_type<T>(), jl_box_uint64(n));
+
+        if (jl_exception_occurred() or ptr == nullptr)
+            throw std::bad_alloc();
+
+        return reinterpret_cast<T*>(jl_unbox_uint64(ptr));
+    }
+
+    template<IsJuliaBits T>
+    void allocator<T>::deallocate(T* ptr, size_t)
+    {
+        // julia may already be shut down when containers with static storage duration are destroyed
+        if (ptr == nullptr or not jl_is_initialized())
+            return;
+
+        jl_function_t* deallocate = detail::cached([&]() -> jl_function_t* { return get_function("jluna.memory_handler", "deallocate"); });
+        jl_call1(deallocate, jl_box_uint64(reinterpret_cast<uint64_t>(ptr)));
+    }
+
+    template<IsJuliaBits T>
+    template<IsJuliaBits U>
+    bool allocator<T>::operator==(const allocator<U>&) const noexcept
+    {
+        return true;
+    }
+
+    template<IsJuliaBits T>
+    jl_value_t* box(const std::vector<T, allocator<T>>& vector)
+    {
+        if (vector.data() == nullptr)
+            return (jl_value_t*) jl_alloc_array_1d(jl_apply_array_type((jl_value_t*) to_julia_type<T>(), 1), 0);
+
+        jl_function_t* wrap_allocation = detail::cached([&]() -> jl_function_t* { return get_function("jluna.memory_handler", "wrap_allocation"); });
+
+        auto before = jl_gc_is_enabled();
+        jl_gc_enable(false);
+
+        auto* out = jl_call2(wrap_allocation, jl_box_uint64(reinterpret_cast<uint64_t>(vector.data())), jl_box_uint64(vector.size()));
+
+        jl_gc_enable(before);
+        return out;
+    }
+}
@@ -24,6 +24,13 @@ namespace jluna
         assert_type(value, "Array");
     }
 
+    template<Boxable V, size_t R>
+    Array<V, R>::Array(const std::shared_ptr<typename Proxy<State>::ProxyValue>& content)
+        : Proxy<State>(content)
+    {
+        assert_type(content->value(), "Array");
+    }
+
     /*
     template<Boxable V, size_t R>
     template<Boxable T>
@@ -35,7 +42,7 @@ namespace jluna
     template<Boxable T, size_t Rank>
     size_t Array<T, Rank>::get_dimension(int index)
     {
-        static jl_function_t* size = jl_get_function(jl_base_module, "size");
+        jl_function_t* size = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "size"); });
         return jl_unbox_uint64(jl_call2(size, _content->value(), jl_box_int32(index + 1)));
     }
 
@@ -103,8 +110,8 @@ namespace jluna
     template<Iterable Range_t>
     auto Array<V, R>::operator[](const Range_t& range)
     {
-        static jl_function_t* getindex = jl_get_function(jl_base_module, "getindex");
-        static jl_function_t* make_vector = jl_get_function((jl_module_t*) jl_eval_string("return jluna"), "make_vector");
+        jl_function_t* getindex = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "getindex"); });
+        jl_function_t* make_vector = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return jluna"), "make_vector"); });
 
         std::vector<jl_value_t*> args;
 
@@ -215,7 +222,7 @@ namespace jluna
     template<Boxable V, size_t R>
     auto Array<V, R>::back()
     {
-        static jl_function_t* length = jl_get_function(jl_base_module, "length");
+        jl_function_t* length = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "length"); });
         return operator[](jl_unbox_uint64(jl_call1(length, _content->value())) - 1);
     }
 
@@ -223,24 +230,36 @@ namespace jluna
     template<Unboxable T>
     T Array<V, R>::back() const
     {
-        static jl_function_t* length = jl_get_function(jl_base_module, "length");
+        jl_function_t* length = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "length"); });
         return operator[]<T>(jl_unbox_uint64(jl_call1(length, _content->value())) - 1);
     }
 
     template<Boxable V, size_t R>
     size_t Array<V, R>::get_n_elements() const
     {
-        static jl_function_t* length = jl_get_function(jl_base_module, "length");
+        jl_function_t* length = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "length"); });
         return jl_unbox_uint64(jl_call1(length, _content->value()));
     }
 
     template<Boxable V, size_t R>
     bool Array<V, R>::empty() const
     {
-        static jl_function_t* isempty = jl_get_function(jl_base_module, "isempty");
+        jl_function_t* isempty = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "isempty"); });
         return jl_unbox_bool(jl_call1(isempty, _content->value()));
     }
 
+    template<Boxable V, size_t R>
+    V* Array<V, R>::data() requires IsJuliaBits<V>
+    {
+        return reinterpret_cast<V*>(jl_array_data((jl_array_t*) _content->value()));
+    }
+
+    template<Boxable V, size_t R>
+    const V* Array<V, R>::data() const requires IsJuliaBits<V>
+    {
+        return reinterpret_cast<const V*>(jl_array_data((jl_array_t*) _content->value()));
+    }
+
     // ###
 
     template<Boxable V>
@@ -257,10 +276,17 @@ namespace jluna
         assert_type(value, "Vector");
     }
 
+    template<Boxable V>
+    Vector<V>::Vector(const std::shared_ptr<typename Proxy<State>::ProxyValue>& content)
+        : Array<V, 1>(content)
+    {
+        assert_type(content->value(), "Vector");
+    }
+
     template<Boxable V>
     void Vector<V>::insert(size_t pos, V value)
     {
-        static jl_value_t* insert = jl_get_function(jl_base_module, "insert!");
+        jl_value_t* insert = detail::cached([&]() -> jl_value_t* { return jl_get_function(jl_base_module, "insert!"); });
         jl_call3(insert, _content->value(), jl_box_uint64(pos + 1), box(value));
         forward_last_exception();
     }
@@ -268,7 +294,7 @@ namespace jluna
     template<Boxable V>
     void Vector<V>::erase(size_t pos)
     {
-        static jl_value_t* deleteat = jl_get_function(jl_base_module, "deleteat!");
+        jl_value_t* deleteat = detail::cached([&]() -> jl_value_t* { return jl_get_function(jl_base_module, "deleteat!"); });
         jl_call2(deleteat, _content->value(), jl_box_uint64(pos + 1));
         forward_last_exception();
     }
@@ -277,7 +303,7 @@ namespace jluna
     template<Boxable T>
     void Vector<V>::push_front(T value)
     {
-        static jl_value_t* pushfirst = jl_get_function(jl_base_module, "pushfirst!");
+        jl_value_t* pushfirst = detail::cached([&]() -> jl_value_t* { return jl_get_function(jl_base_module, "pushfirst!"); });
         jl_call2(pushfirst, _content->value(), box(value));
         forward_last_exception();
     }
@@ -286,7 +312,7 @@ namespace jluna
     template<Boxable T>
     void Vector<V>::push_back(T value)
     {
-        static jl_value_t* push = jl_get_function(jl_base_module, "push!");
+        jl_value_t* push = detail::cached([&]() -> jl_value_t* { return jl_get_function(jl_base_module, "push!"); });
         jl_call2(push, _content->value(), box(value));
         forward_last_exception();
     }
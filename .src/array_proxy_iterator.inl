@@ -56,7 +56,7 @@ namespace jluna
     template<Unboxable T>
     T Array<V, R>::ConstIterator::operator*() const
     {
-        static jl_function_t* getindex = jl_get_function(jl_base_module, "getindex");
+        jl_function_t* getindex = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "getindex"); });
         return unbox<T>(jluna::safe_call(getindex, _owner->operator jl_value_t *(), box(_index + 1)));
     }
 
@@ -69,11 +69,7 @@ namespace jluna
     template<Boxable V, size_t R>
     Array<V, R>::ConstIterator::operator Proxy<State>()
     {
-        return Proxy<State>(
-                jl_arrayref((jl_array_t*) _owner->_content->value(), _index),
-                _owner->_content,
-                jl_symbol(("[" + std::to_string(_index+1) + "]").c_str())
-        );
+        return Proxy<State>(jl_arrayref((jl_array_t*) _owner->_content->value(), _index), _owner->_content, _index);
     }
 
     template<Boxable V, size_t R>
@@ -95,7 +91,7 @@ namespace jluna
         if (_index >= _owner->get_n_elements())
             throw std::out_of_range("In: jluna::Array::ConstIterator::operator=(): trying to assign value to past-the-end iterator");
 
-        static jl_function_t* setindex = jl_get_function(jl_base_module, "setindex!");
+        jl_function_t* setindex = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "setindex!"); });
         jl_call3(setindex, _owner->operator jl_value_t *(), box(value), box(_index + 1));
         return *this;
     }
@@ -0,0 +1,54 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 21.02.22 by clem (mail@clemens-cords.com)
+//
+
+namespace jluna
+{
+    template<typename Return_t>
+    template<typename... Args_t>
+    Awaitable<Return_t>::Awaitable(jl_function_t* function, bool spawn, Args_t&&... args)
+        : _schedule([function, spawn, ...args = std::forward<Args_t>(args)](std::function<void(jl_value_t*)>&& callback) mutable {
+            State::schedule_call(std::move(callback), function, spawn, std::move(args)...);
+          })
+    {}
+
+    template<typename Return_t>
+    bool Awaitable<Return_t>::await_ready() const noexcept
+    {
+        return false;
+    }
+
+    template<typename Return_t>
+    void Awaitable<Return_t>::await_suspend(std::coroutine_handle<> handle)
+    {
+        // the task may finish and resume the coroutine before schedule returns, so the awaitable can't be touched after
+        auto schedule = std::move(_schedule);
+        schedule([this, handle](jl_value_t* tuple) {
+
+            try
+            {
+                if constexpr (std::is_same_v<Return_t, void>)
+                    State::unpack_task_result<void>(tuple);
+                else
+                    _result.emplace(State::unpack_task_result<Return_t>(tuple));
+            }
+            catch (...)
+            {
+                _exception = std::current_exception();
+            }
+
+            handle.resume();
+        });
+    }
+
+    template<typename Return_t>
+    Return_t Awaitable<Return_t>::await_resume()
+    {
+        if (_exception != nullptr)
+            std::rethrow_exception(_exception);
+
+        if constexpr (not std::is_same_v<Return_t, void>)
+            return std::move(*_result);
+    }
+}
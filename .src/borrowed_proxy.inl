@@ -0,0 +1,76 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 05.02.22 by clem (mail@clemens-cords.com)
+//
+
+#include <borrowed_proxy.hpp>
+
+namespace jluna
+{
+    template<typename State_t>
+    BorrowedProxy<State_t>::BorrowedProxy(jl_value_t* value)
+        : _value(value)
+    {}
+
+    template<typename State_t>
+    BorrowedProxy<State_t>::BorrowedProxy(Proxy<State_t>& proxy)
+        : _value(proxy.operator jl_value_t*())
+    {}
+
+    template<typename State_t>
+    BorrowedProxy<State_t> BorrowedProxy<State_t>::operator[](const std::string& field) const
+    {
+        jl_function_t* dot = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return Main.jluna"), "dot"); });
+        return BorrowedProxy<State_t>(State_t::safe_call(dot, _value, (jl_value_t*) jl_symbol(field.c_str())));
+    }
+
+    template<typename State_t>
+    BorrowedProxy<State_t> BorrowedProxy<State_t>::operator[](size_t i) const
+    {
+        jl_function_t* getindex = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "getindex"); });
+        return BorrowedProxy<State_t>(State_t::safe_call(getindex, _value, i + 1));
+    }
+
+    template<typename State_t>
+    BorrowedProxy<State_t>::operator jl_value_t*() const
+    {
+        return _value;
+    }
+
+    template<typename State_t>
+    BorrowedProxy<State_t>::operator std::string() const
+    {
+        jl_function_t* to_string = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "string"); });
+        return std::string(jl_string_data(jl_call1(to_string, _value)));
+    }
+
+    template<typename State_t>
+    template<Unboxable T, std::enable_if_t<not std::is_same_v<T, std::string>, bool>>
+    BorrowedProxy<State_t>::operator T() const
+    {
+        return unbox<T>(_value);
+    }
+
+    template<typename State_t>
+    template<Boxable... Args_t>
+    auto BorrowedProxy<State_t>::call(Args_t&&... args) const
+    {
+        jl_function_t* invoke = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return jluna"), "invoke"); });
+        return Proxy<State_t>(State_t::call(invoke, _value, std::forward<Args_t>(args)...), nullptr);
+    }
+
+    template<typename State_t>
+    template<Boxable... Args_t>
+    auto BorrowedProxy<State_t>::safe_call(Args_t&&... args) const
+    {
+        jl_function_t* invoke = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return jluna"), "invoke"); });
+        return Proxy<State_t>(State_t::safe_call(invoke, _value, std::forward<Args_t>(args)...), nullptr);
+    }
+
+    template<typename State_t>
+    template<Boxable... Args_t>
+    auto BorrowedProxy<State_t>::operator()(Args_t&&... args) const
+    {
+        return this->safe_call(std::forward<Args_t>(args)...);
+    }
+}
@@ -0,0 +1,190 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 23.02.22 by clem (mail@clemens-cords.com)
+//
+
+#include <thread>
+#include <bit>
+
+namespace jluna
+{
+    template<typename T>
+    size_t Channel<T>::round_capacity(size_t capacity)
+    {
+        return std::bit_ceil(std::max<size_t>(capacity, 2));
+    }
+
+    template<typename T>
+    Channel<T>::Channel(size_t capacity)
+        : _mask(round_capacity(capacity) - 1),
+          _sequences(new std::atomic<uint64_t>[round_capacity(capacity)])
+    {
+        THROW_IF_UNINITIALIZED;
+
+        for (auto& position : _positions)
+            position.store(0, std::memory_order_relaxed);
+
+        for (size_t i = 0; i <= _mask; ++i)
+            _sequences[i].store(i, std::memory_order_relaxed);
+
+        if constexpr (_is_bits)
+            _values = std::unique_ptr<T[]>(new T[_mask + 1]);
+
+        jl_function_t* new_ring_channel = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return jluna.channel_handler"), "new_ring_channel"); });
+
+        jl_value_t* type;
+        if constexpr (_is_bits)
+            type = (jl_value_t*) to_julia_type<T>();
+        else
+            type = (jl_value_t*) jl_any_type;
+
+        auto before = jl_gc_is_enabled();
+        jl_gc_enable(false);
+
+        _channel = State::safe_call(new_ring_channel,
+            type,
+            jl_box_uint64(reinterpret_cast<uint64_t>(_positions)),
+            jl_box_uint64(reinterpret_cast<uint64_t>(_sequences.get())),
+            jl_box_uint64(reinterpret_cast<uint64_t>(_values.get())),
+            jl_box_uint64(_mask + 1)
+        );
+
+        _channel_key = State::create_reference(_channel);
+
+        if constexpr (not _is_bits)
+            _slots = (jl_array_t*) jl_get_field(_channel, "_values");
+
+        jl_gc_enable(before);
+    }
+
+    template<typename T>
+    Channel<T>::~Channel()
+    {
+        close();
+        State::free_reference(_channel_key);
+    }
+
+    template<typename T>
+    bool Channel<T>::try_push(const T& value)
+    {
+        if (is_closed())
+            return false;
+
+        // Vyukov's bounded queue: a slot is free for position p if its sequence is p and filled if it is p + 1
+        uint64_t position = _positions[_enqueue_index].load(std::memory_order_relaxed);
+        while (true)
+        {
+            auto& sequence = _sequences[position & _mask];
+            auto difference = static_cast<int64_t>(sequence.load(std::memory_order_acquire)) - static_cast<int64_t>(position);
+
+            if (difference == 0)
+            {
+                if (_positions[_enqueue_index].compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (difference < 0)
+                return false;
+            else
+                position = _positions[_enqueue_index].load(std::memory_order_relaxed);
+        }
+
+        if constexpr (_is_bits)
+            _values[position & _mask] = value;
+        else
+            jl_arrayset(_slots, box(value), position & _mask);
+
+        _sequences[position & _mask].store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename T>
+    bool Channel<T>::try_pop(T& out)
+    {
+        uint64_t position = _positions[_dequeue_index].load(std::memory_order_relaxed);
+        while (true)
+        {
+            auto& sequence = _sequences[position & _mask];
+            auto difference = static_cast<int64_t>(sequence.load(std::memory_order_acquire)) - static_cast<int64_t>(position + 1);
+
+            if (difference == 0)
+            {
+                if (_positions[_dequeue_index].compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (difference < 0)
+                return false;
+            else
+                position = _positions[_dequeue_index].load(std::memory_order_relaxed);
+        }
+
+        if constexpr (_is_bits)
+            out = _values[position & _mask];
+        else
+        {
+            out = unbox<T>(jl_arrayref(_slots, position & _mask));
+            jl_arrayset(_slots, jl_nothing, position & _mask);
+        }
+
+        _sequences[position & _mask].store(position + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename T>
+    bool Channel<T>::push(const T& value)
+    {
+        while (not try_push(value))
+        {
+            if (is_closed())
+                return false;
+
+            std::this_thread::yield();
+        }
+
+        return true;
+    }
+
+    template<typename T>
+    std::optional<T> Channel<T>::pop()
+    {
+        T out;
+        while (not try_pop(out))
+        {
+            if (is_closed())
+            {
+                // a value may have been pushed right before the channel was closed
+                if (try_pop(out))
+                    break;
+
+                return std::nullopt;
+            }
+
+            std::this_thread::yield();
+        }
+
+        return out;
+    }
+
+    template<typename T>
+    void Channel<T>::close()
+    {
+        _positions[_closed_index].store(1, std::memory_order_release);
+    }
+
+    template<typename T>
+    bool Channel<T>::is_closed() const
+    {
+        return _positions[_closed_index].load(std::memory_order_acquire) != 0;
+    }
+
+    template<typename T>
+    size_t Channel<T>::capacity() const
+    {
+        return _mask + 1;
+    }
+
+    template<typename T>
+    Channel<T>::operator jl_value_t*()
+    {
+        return _channel;
+    }
+}
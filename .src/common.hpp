@@ -76,12 +76,12 @@ namespace jluna
     {
         THROW_IF_UNINITIALIZED;
 
-        static jl_function_t* tostring = jl_get_function(jl_base_module, "string");
+        jl_function_t* tostring = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "string"); });
 
         std::vector<jl_value_t*> params = {(jl_value_t*) function};
         (params.push_back(reinterpret_cast<jl_value_t*>(args)), ...);
 
-        static jl_function_t* safe_call = jl_get_function((jl_module_t*) jl_eval_string("return jluna.exception_handler"), "safe_call");
+        jl_function_t* safe_call = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return jluna.exception_handler"), "safe_call"); });
         auto* result = jl_call(safe_call, params.data(), params.size());
 
         forward_last_exception();
@@ -91,9 +91,9 @@ namespace jluna
     static auto safe_call_params(std::vector<jl_value_t*> params)
     {
         THROW_IF_UNINITIALIZED;
-        static jl_function_t* tostring = jl_get_function(jl_base_module, "string");
+        jl_function_t* tostring = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "string"); });
 
-        static jl_function_t* safe_call = jl_get_function((jl_module_t*) jl_eval_string("return jluna.exception_handler"), "safe_call");
+        jl_function_t* safe_call = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return jluna.exception_handler"), "safe_call"); });
         auto* result = jl_call(safe_call, params.data(), params.size());
 
         forward_last_exception();
@@ -106,7 +106,7 @@ namespace jluna
     {
         THROW_IF_UNINITIALIZED;
 
-        static jl_function_t* tostring = jl_get_function(jl_base_module, "string");
+        jl_function_t* tostring = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "string"); });
 
         auto params = std::vector<jl_value_t*>();
         (params.push_back(reinterpret_cast<jl_value_t*>(args)), ...);
@@ -121,19 +121,19 @@ namespace jluna
 
     static void assert_type(jl_value_t* value, const std::string& type_str)
     {
-        static jl_function_t* assert_isa = get_function("jluna", "assert_isa");
+        jl_function_t* assert_isa = detail::cached([&]() -> jl_function_t* { return get_function("jluna", "assert_isa"); });
         safe_call(assert_isa, value, jl_symbol(type_str.c_str()));
     }
 
     static jl_value_t* try_convert(jl_value_t* origin, const std::string& target_type)
     {
-        static jl_function_t* convert = get_function("jluna", "convert");
+        jl_function_t* convert = detail::cached([&]() -> jl_function_t* { return get_function("jluna", "convert"); });
         return safe_call(convert, origin, jl_symbol(target_type.c_str()));
     }
 
     static jl_value_t* try_convert(jl_value_t* origin, jl_datatype_t* type)
     {
-        static jl_function_t* convert = jl_get_function(jl_base_module, "convert");
+        jl_function_t* convert = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "convert"); });
         return safe_call(convert, type, origin);
     }
 }
@@ -0,0 +1,149 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 04.03.22 by clem (mail@clemens-cords.com)
+//
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+namespace jluna
+{
+    namespace detail
+    {
+        /// @brief can every value of From be converted to To without julia throwing an InexactError
+        template<IsJuliaBits From, IsJuliaBits To>
+        constexpr bool is_always_representable()
+        {
+            if constexpr (std::is_same_v<From, To> or std::is_same_v<From, Bool>)
+                return true;
+            else if constexpr (std::is_same_v<To, Bool>)
+                return false;
+            else if constexpr (std::is_floating_point_v<To>)
+                return true;
+            else if constexpr (std::is_floating_point_v<From>)
+                return false;
+            else
+                return std::in_range<To>(std::numeric_limits<From>::min()) and std::in_range<To>(std::numeric_limits<From>::max());
+        }
+
+        /// @brief can value be converted to To without julia throwing an InexactError, free of branches so loops over it vectorize
+        template<IsJuliaBits To, IsJuliaBits From>
+        bool is_representable(From x)
+        {
+            if constexpr (std::is_same_v<To, Bool>)
+                return (x == From(0)) | (x == From(1));
+            else if constexpr (std::is_floating_point_v<From>)
+            {
+                // both bounds are powers of 2, so they are exact in any floating point type
+                constexpr From lower = static_cast<From>(std::numeric_limits<To>::min());
+                constexpr From upper = From(2) * static_cast<From>(std::numeric_limits<To>::max() / 2 + 1);
+                return (x >= lower) & (x < upper) & (std::trunc(x) == x);
+            }
+            else
+                return std::in_range<To>(x);
+        }
+
+        template<IsJuliaBits To>
+        bool convert_elements(jl_array_t* in, To* out)
+        {
+            auto* type = jl_tparam0(jl_typeof((jl_value_t*) in));
+            auto* data = jl_array_data(in);
+            size_t n = jl_array_len(in);
+
+            if (type == (jl_value_t*) jl_bool_type)
+                return jluna::convert_elements(reinterpret_cast<const Bool*>(data), out, n);
+            else if (type == (jl_value_t*) jl_int8_type)
+                return jluna::convert_elements(reinterpret_cast<const Int8*>(data), out, n);
+            else if (type == (jl_value_t*) jl_int16_type)
+                return jluna::convert_elements(reinterpret_cast<const Int16*>(data), out, n);
+            else if (type == (jl_value_t*) jl_int32_type)
+                return jluna::convert_elements(reinterpret_cast<const Int32*>(data), out, n);
+            else if (type == (jl_value_t*) jl_int64_type)
+                return jluna::convert_elements(reinterpret_cast<const Int64*>(data), out, n);
+            else if (type == (jl_value_t*) jl_uint8_type)
+                return jluna::convert_elements(reinterpret_cast<const UInt8*>(data), out, n);
+            else if (type == (jl_value_t*) jl_uint16_type)
+                return jluna::convert_elements(reinterpret_cast<const UInt16*>(data), out, n);
+            else if (type == (jl_value_t*) jl_uint32_type)
+                return jluna::convert_elements(reinterpret_cast<const UInt32*>(data), out, n);
+            else if (type == (jl_value_t*) jl_uint64_type)
+                return jluna::convert_elements(reinterpret_cast<const UInt64*>(data), out, n);
+            else if (type == (jl_value_t*) jl_float32_type)
+                return jluna::convert_elements(reinterpret_cast<const Float32*>(data), out, n);
+            else if (type == (jl_value_t*) jl_float64_type)
+                return jluna::convert_elements(reinterpret_cast<const Float64*>(data), out, n);
+            else
+                return false;
+        }
+    }
+
+    template<IsJuliaBits From, IsJuliaBits To>
+    bool convert_elements(const From* in, To* out, size_t n)
+    {
+        if constexpr (not detail::is_always_representable<From, To>())
+        {
+            // check everything first, so out stays untouched on failure and the conversion loop has no early exit
+            bool representable = true;
+            for (size_t i = 0; i < n; ++i)
+                representable &= detail::is_representable<To>(in[i]);
+
+            if (not representable)
+                return false;
+        }
+
+        if constexpr (std::is_same_v<From, To>)
+        {
+            if (n > 0 and in != out)
+                std::memcpy(out, in, n * sizeof(To));
+        }
+        else
+        {
+            for (size_t i = 0; i < n; ++i)
+                out[i] = static_cast<To>(in[i]);
+        }
+
+        return true;
+    }
+
+    template<IsJuliaBits To, IsJuliaBits From>
+    jl_value_t* box_as(const From* data, size_t n)
+    {
+        THROW_IF_UNINITIALIZED;
+
+        auto before = jl_gc_is_enabled();
+        jl_gc_enable(false);
+
+        auto* out = jl_alloc_array_1d(jl_apply_array_type((jl_value_t*) to_julia_type<To>(), 1), n);
+
+        if (not convert_elements(data, reinterpret_cast<To*>(jl_array_data(out)), n))
+        {
+            // let julia convert instead, so it throws the same exception boxing element-wise would
+            jl_function_t* convert = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "convert"); });
+
+            auto* in = jl_alloc_array_1d(jl_apply_array_type((jl_value_t*) to_julia_type<From>(), 1), n);
+            std::memcpy(jl_array_data(in), data, n * sizeof(From));
+
+            try
+            {
+                out = (jl_array_t*) safe_call(convert, jl_apply_array_type((jl_value_t*) to_julia_type<To>(), 1), (jl_value_t*) in);
+            }
+            catch (...)
+            {
+                jl_gc_enable(before);
+                throw;
+            }
+        }
+
+        jl_gc_enable(before);
+        return (jl_value_t*) out;
+    }
+
+    template<IsJuliaBits To, IsJuliaBits From>
+        requires (not std::is_same_v<From, Bool>)
+    jl_value_t* box_as(const std::vector<From>& vector)
+    {
+        return box_as<To>(vector.data(), vector.size());
+    }
+}
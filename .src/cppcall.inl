@@ -8,60 +8,95 @@
 #include <typedefs.hpp>
 #include <exceptions.hpp>
 #include <box_any.hpp>
+#include <optional>
+#include <stdexcept>
 
 namespace jluna
 {
     namespace detail
     {
         template<typename Lambda_t, typename Return_t, typename... Args_t, std::enable_if_t<std::is_same_v<Return_t, void>, Bool> = true>
-        jl_value_t* detail::invoke_lambda(const Lambda_t* func, Args_t... args)
+        jl_value_t* detail::invoke_lambda(bool gc_safe, const Lambda_t* func, Args_t... args)
         {
-            (*func)(args...);
+            if (gc_safe)
+            {
+                GCSafeRegion region;
+                (*func)(args...);
+            }
+            else
+                (*func)(args...);
+
             return jl_nothing;
         }
 
         template<typename Lambda_t, typename Return_t, typename... Args_t, std::enable_if_t<std::is_same_v<Return_t, jl_value_t*>, Bool> = true>
-        jl_value_t* detail::invoke_lambda(const Lambda_t* func, Args_t... args)
+        jl_value_t* detail::invoke_lambda(bool gc_safe, const Lambda_t* func, Args_t... args)
+        {
+            // never gc_safe, see throw_if_unrooted_result
+            return (*func)(args...);
+        }
+
+        template<typename Lambda_t, typename Return_t, typename... Args_t, std::enable_if_t<not std::is_same_v<Return_t, void> and not std::is_same_v<Return_t, jl_value_t*>, Bool> = true>
+        jl_value_t* detail::invoke_lambda(bool gc_safe, const Lambda_t* func, Args_t... args)
+        {
+            if (not gc_safe)
+                return box((*func)(args...));
+
+            std::optional<Return_t> res;
+            {
+                GCSafeRegion region;
+                res.emplace((*func)(args...));
+            }
+
+            return box(std::move(*res));
+        }
+
+        template<typename Return_t>
+        void throw_if_unrooted_result(const std::string& name, bool gc_safe)
         {
-            jl_value_t* res = (*func)(args...);
-            return res;
+            if (std::is_same_v<Return_t, jl_value_t*> and gc_safe)
+                throw std::invalid_argument("In register_function: \"" + name + "\" returns jl_value_t* and can thus not be gc_safe, as the result would be unrooted until the calling thread leaves its GC-safe state. Return a C++ value instead, it will be boxed after leaving that state");
         }
     }
 
     template<LambdaType<> Lambda_t>
-    void register_function(const std::string& name, const Lambda_t& lambda)
+    void register_function(const std::string& name, const Lambda_t& lambda, bool gc_safe)
     {
         THROW_IF_UNINITIALIZED;
+        detail::throw_if_unrooted_result<std::invoke_result_t<Lambda_t>>(name, gc_safe);
 
-        c_adapter::register_function(name, 0, [lambda](jl_value_t* tuple) -> jl_value_t* {
+        c_adapter::register_function(name, 0, [lambda, gc_safe](jl_value_t* tuple) -> jl_value_t* {
 
             return detail::invoke_lambda<Lambda_t, std::invoke_result_t<Lambda_t>>(
-                    &lambda
+                    gc_safe, &lambda
             );
         });
     }
 
     template<LambdaType<jl_value_t*> Lambda_t>
-    void register_function(const std::string& name, const Lambda_t& lambda)
+    void register_function(const std::string& name, const Lambda_t& lambda, bool gc_safe)
     {
         THROW_IF_UNINITIALIZED;
+        detail::throw_if_unrooted_result<std::invoke_result_t<Lambda_t, jl_value_t*>>(name, gc_safe);
 
-        c_adapter::register_function(name, 1, [lambda](jl_value_t* tuple) -> jl_value_t* {
+        c_adapter::register_function(name, 1, [lambda, gc_safe](jl_value_t* tuple) -> jl_value_t* {
 
             return detail::invoke_lambda<Lambda_t, std::invoke_result_t<Lambda_t, jl_value_t*>, jl_value_t*>(
-                    &lambda,
+                    gc_safe, &lambda,
                     jl_tupleref(tuple, 0)
             );
         });
     }
 
     template<LambdaType<jl_value_t*, jl_value_t*> Lambda_t>
-    void register_function(const std::string& name, const Lambda_t& lambda)
+    void register_function(const std::string& name, const Lambda_t& lambda, bool gc_safe)
     {
-        c_adapter::register_function(name, 2, [lambda](jl_value_t* tuple) -> jl_value_t* {
+        detail::throw_if_unrooted_result<std::invoke_result_t<Lambda_t, jl_value_t*, jl_value_t*>>(name, gc_safe);
+
+        c_adapter::register_function(name, 2, [lambda, gc_safe](jl_value_t* tuple) -> jl_value_t* {
 
             return detail::invoke_lambda<Lambda_t, std::invoke_result_t<Lambda_t, jl_value_t*, jl_value_t*>, jl_value_t*, jl_value_t*>(
-                    &lambda,
+                    gc_safe, &lambda,
                     jl_tupleref(tuple, 0),
                     jl_tupleref(tuple, 1)
             );
@@ -69,12 +104,14 @@ namespace jluna
     }
 
     template<LambdaType<jl_value_t*, jl_value_t*, jl_value_t*> Lambda_t>
-    void register_function(const std::string& name, const Lambda_t& lambda)
+    void register_function(const std::string& name, const Lambda_t& lambda, bool gc_safe)
     {
-        c_adapter::register_function(name, 3, [lambda](jl_value_t* tuple) -> jl_value_t* {
+        detail::throw_if_unrooted_result<std::invoke_result_t<Lambda_t, jl_value_t*, jl_value_t*, jl_value_t*>>(name, gc_safe);
+
+        c_adapter::register_function(name, 3, [lambda, gc_safe](jl_value_t* tuple) -> jl_value_t* {
 
             return detail::invoke_lambda<Lambda_t, std::invoke_result_t<Lambda_t, jl_value_t*, jl_value_t*, jl_value_t*>, jl_value_t*, jl_value_t*, jl_value_t*>(
-                    &lambda,
+                    gc_safe, &lambda,
                     jl_tupleref(tuple, 0),
                     jl_tupleref(tuple, 1),
                     jl_tupleref(tuple, 2)
@@ -83,12 +120,14 @@ namespace jluna
     }
 
     template<LambdaType<jl_value_t*, jl_value_t*, jl_value_t*, jl_value_t*> Lambda_t>
-    void register_function(const std::string& name, const Lambda_t& lambda)
+    void register_function(const std::string& name, const Lambda_t& lambda, bool gc_safe)
     {
-        c_adapter::register_function(name, 4, [lambda](jl_value_t* tuple) -> jl_value_t* {
+        detail::throw_if_unrooted_result<std::invoke_result_t<Lambda_t, jl_value_t*, jl_value_t*, jl_value_t*, jl_value_t*>>(name, gc_safe);
+
+        c_adapter::register_function(name, 4, [lambda, gc_safe](jl_value_t* tuple) -> jl_value_t* {
 
             return detail::invoke_lambda<Lambda_t, std::invoke_result_t<Lambda_t, jl_value_t*, jl_value_t*, jl_value_t*, jl_value_t*>, jl_value_t*, jl_value_t*, jl_value_t*, jl_value_t*>(
-                    &lambda,
+                    gc_safe, &lambda,
                     jl_tupleref(tuple, 0),
                     jl_tupleref(tuple, 1),
                     jl_tupleref(tuple, 2),
@@ -98,12 +137,14 @@ namespace jluna
     }
 
     template<LambdaType<jl_value_t*, jl_value_t*, jl_value_t*, jl_value_t*, jl_value_t*> Lambda_t>
-    void register_function(const std::string& name, const Lambda_t& lambda)
+    void register_function(const std::string& name, const Lambda_t& lambda, bool gc_safe)
     {
-        c_adapter::register_function(name, 5, [lambda](jl_value_t* tuple) -> jl_value_t* {
+        detail::throw_if_unrooted_result<std::invoke_result_t<Lambda_t, jl_value_t*, jl_value_t*, jl_value_t*, jl_value_t*, jl_value_t*>>(name, gc_safe);
+
+        c_adapter::register_function(name, 5, [lambda, gc_safe](jl_value_t* tuple) -> jl_value_t* {
 
             return detail::invoke_lambda<Lambda_t, std::invoke_result_t<Lambda_t, jl_value_t*, jl_value_t*, jl_value_t*, jl_value_t*, jl_value_t*>, jl_value_t*, jl_value_t*, jl_value_t*, jl_value_t*, jl_value_t*>(
-                    &lambda,
+                    gc_safe, &lambda,
                     jl_tupleref(tuple, 0),
                     jl_tupleref(tuple, 1),
                     jl_tupleref(tuple, 2),
@@ -114,9 +155,11 @@ namespace jluna
     }
 
     template<LambdaType<std::vector<jl_value_t*>> Lambda_t>
-    void register_function(const std::string& name, const Lambda_t& lambda)
+    void register_function(const std::string& name, const Lambda_t& lambda, bool gc_safe)
     {
-        c_adapter::register_function(name, 1, [lambda](jl_value_t* tuple) -> jl_value_t* {
+        detail::throw_if_unrooted_result<std::invoke_result_t<Lambda_t, std::vector<jl_value_t*>>>(name, gc_safe);
+
+        c_adapter::register_function(name, 1, [lambda, gc_safe](jl_value_t* tuple) -> jl_value_t* {
 
             std::vector<jl_value_t*> wrapped;
 
@@ -127,7 +170,7 @@ namespace jluna
                 Lambda_t,
                 std::invoke_result_t<Lambda_t, std::vector<jl_value_t*>>,
                 std::vector<jl_value_t*>>(
-                    &lambda, wrapped
+                    gc_safe, &lambda, wrapped
             );
         });
     }
@@ -144,7 +187,7 @@ namespace jluna
         std::string id = "#" + std::to_string(++detail::_internal_function_id_name);
         register_function(id, lambda);
 
-        static jl_function_t* new_unnamed_function = get_function("_cppcall", "new_unnamed_function");
+        jl_function_t* new_unnamed_function = detail::cached([&]() -> jl_function_t* { return get_function("_cppcall", "new_unnamed_function"); });
         return jl_call1(new_unnamed_function, (jl_value_t*) jl_symbol(id.c_str()));
     }
 
@@ -0,0 +1,90 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 24.02.22 by clem (mail@clemens-cords.com)
+//
+
+#include <csignal>
+#include <unistd.h>
+#include <stdexcept>
+
+namespace jluna::detail
+{
+    Deadline::Deadline(std::chrono::nanoseconds timeout)
+        : _timeout(timeout)
+    {
+        assert(jl_is_initialized() && "initiate the state via jluna::State::initialize() before trying to interact with julia or jluna");
+
+        if (jl_threadid() != 0)
+            throw std::runtime_error("In Deadline::Deadline: only the thread that initialized julia can be interrupted");
+
+        // SIGINT should raise an InterruptException instead of terminating the process, restored in the dtor
+        jl_exit_on_sigint(0);
+
+        _watchdog = std::thread([this](){
+
+            std::unique_lock<std::mutex> lock(_mutex);
+            if (_cv.wait_for(lock, _timeout, [this](){return _status != ARMED;}))
+                return;
+
+            // julias signal listener thread receives it and interrupts thread 0
+            _status = FIRED;
+            kill(getpid(), SIGINT);
+        });
+    }
+
+    Deadline::~Deadline()
+    {
+        disarm();
+        jl_exit_on_sigint(_exit_on_sigint.load());
+    }
+
+    void Deadline::set_exit_on_sigint(bool on)
+    {
+        _exit_on_sigint.store(on);
+        jl_exit_on_sigint(on);
+    }
+
+    bool Deadline::disarm()
+    {
+        if (_joined)
+            return _delivered;
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_status == ARMED)
+                _status = DISARMED;
+        }
+
+        _cv.notify_one();
+        _watchdog.join();
+        _joined = true;
+
+        if (_status != FIRED)
+            return false;
+
+        jl_function_t* has_interrupt_occurred = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return jluna.exception_handler"), "has_interrupt_occurred"); });
+        jl_function_t* absorb_interrupt = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return jluna.exception_handler"), "absorb_interrupt"); });
+
+        // if the call returned before the interrupt reached it, its result is valid. Wait for the interrupt here so it can't hit unrelated code later
+        if (jl_exception_occurred() != jl_interrupt_exception and not jl_unbox_bool(jl_call0(has_interrupt_occurred)))
+        {
+            jl_call0(absorb_interrupt);
+            return false;
+        }
+
+        _delivered = true;
+        _expired_timeout = _timeout;
+        _expired = true;
+        return true;
+    }
+
+    bool Deadline::consume_expired(std::chrono::nanoseconds& timeout)
+    {
+        if (not _expired)
+            return false;
+
+        _expired = false;
+        timeout = _expired_timeout;
+        return true;
+    }
+}
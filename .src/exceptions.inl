@@ -5,6 +5,7 @@
 
 #include <exceptions.hpp>
 #include <global_utilities.hpp>
+#include <deadline.hpp>
 #include <julia.h>
 
 namespace jluna
@@ -20,10 +21,14 @@ namespace jluna
     {
         THROW_IF_UNINITIALIZED;
 
+        std::chrono::nanoseconds timeout;
+        if (detail::Deadline::consume_expired(timeout))
+            throw TimeoutException(jl_exception_occurred() != nullptr ? jl_exception_occurred() : jl_interrupt_exception, timeout);
+
         auto* maybe =jl_exception_occurred();
         if (maybe != nullptr)
         {
-            static jl_function_t* tostring = jl_get_function(jl_base_module, "string");
+            jl_function_t* tostring = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "string"); });
 
             std::stringstream str;
             str << jl_string_data(jl_call1(tostring, jl_exception_occurred())) << "\nStacktrace: <no stacktrace available>" << std::endl;
@@ -54,6 +59,10 @@ namespace jluna
         return _value;
     }
 
+    TimeoutException::TimeoutException(jl_value_t* exception, std::chrono::nanoseconds timeout)
+        : JuliaException(exception, "TimeoutException: call did not finish within " + std::to_string(std::chrono::duration<double>(timeout).count()) + "s and was interrupted")
+    {}
+
     ImmutableVariableException::ImmutableVariableException(jl_value_t* value)
     {
         std::stringstream str;
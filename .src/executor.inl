@@ -0,0 +1,145 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 22.02.22 by clem (mail@clemens-cords.com)
+//
+
+#include <executor.hpp>
+#include <gc_region.hpp>
+
+namespace jluna
+{
+    Executor::Executor(const std::string& image, size_t batch_size)
+        : _batch_size(batch_size)
+    {
+        assert(not jl_is_initialized() && "In Executor::Executor: the executor needs to own the julia state, do not call State::initialize before creating it");
+        assert(batch_size > 0);
+
+        std::promise<void> initialized;
+        auto future = initialized.get_future();
+
+        _thread = std::thread([this, image, &initialized](){
+
+            try
+            {
+                State::initialize(image);
+            }
+            catch (...)
+            {
+                initialized.set_exception(std::current_exception());
+                return;
+            }
+
+            initialized.set_value();
+            run();
+        });
+
+        // the thread has to be joined before rethrowing, the dtor does not run if the ctor throws
+        try
+        {
+            future.get();
+        }
+        catch (...)
+        {
+            _thread.join();
+            throw;
+        }
+    }
+
+    Executor::~Executor()
+    {
+        _running.store(false, std::memory_order_release);
+        notify();
+        _thread.join();
+    }
+
+    template<typename Lambda_t>
+    std::future<std::invoke_result_t<Lambda_t>> Executor::execute(Lambda_t&& lambda)
+    {
+        using Return_t = std::invoke_result_t<Lambda_t>;
+
+        auto task = std::make_shared<std::packaged_task<Return_t()>>(std::forward<Lambda_t>(lambda));
+        auto future = task->get_future();
+
+        _queue.push([task](){ (*task)(); });
+        notify();
+
+        return future;
+    }
+
+    template<typename Lambda_t>
+    void Executor::post(Lambda_t&& lambda)
+    {
+        _queue.push([lambda = std::forward<Lambda_t>(lambda)]() mutable {
+
+            try
+            {
+                lambda();
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << "exception in jluna::Executor::post: " << e.what() << std::endl;
+            }
+            catch (...)
+            {
+                std::cerr << "exception in jluna::Executor::post: unknown exception" << std::endl;
+            }
+        });
+        notify();
+    }
+
+    bool Executor::is_executor_thread() const
+    {
+        return std::this_thread::get_id() == _thread.get_id();
+    }
+
+    void Executor::notify()
+    {
+        _signal.fetch_add(1, std::memory_order_release);
+        _signal.notify_one();
+    }
+
+    void Executor::run()
+    {
+        std::function<void()> closure;
+
+        while (true)
+        {
+            size_t seen = _signal.load(std::memory_order_acquire);
+
+            // drain in batches, references released by the batch are handed to julia in one go afterwards
+            size_t n = 0;
+            do
+            {
+                n = 0;
+                while (n < _batch_size and _queue.try_pop(closure))
+                {
+                    closure();
+                    closure = nullptr;
+                    n += 1;
+                }
+
+                if (n > 0)
+                    State::flush_references();
+            }
+            while (n == _batch_size);
+
+            if (not _running.load(std::memory_order_acquire))
+            {
+                // a producer may have pushed between the last pop and the stop request
+                while (_queue.try_pop(closure))
+                    closure();
+
+                break;
+            }
+
+            {
+                // lets other threads collect garbage while this one sleeps
+                GCSafeRegion region;
+                _signal.wait(seen, std::memory_order_acquire);
+            }
+        }
+
+        State::flush_references();
+        detail::on_exit();
+    }
+}
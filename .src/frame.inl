@@ -0,0 +1,20 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 04.02.22 by clem (mail@clemens-cords.com)
+//
+
+#include <frame.hpp>
+
+namespace jluna
+{
+    Frame::Frame()
+    {
+        THROW_IF_UNINITIALIZED;
+        State::push_frame();
+    }
+
+    Frame::~Frame() noexcept
+    {
+        State::pop_frame();
+    }
+}
@@ -0,0 +1,32 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 25.02.22 by clem (mail@clemens-cords.com)
+//
+
+#include <gc_region.hpp>
+#include <exceptions.hpp>
+
+namespace jluna
+{
+    GCSafeRegion::GCSafeRegion()
+    {
+        THROW_IF_UNINITIALIZED;
+        _state = jl_gc_safe_enter(jl_current_task->ptls);
+    }
+
+    GCSafeRegion::~GCSafeRegion()
+    {
+        jl_gc_safe_leave(jl_current_task->ptls, _state);
+    }
+
+    GCUnsafeRegion::GCUnsafeRegion()
+    {
+        THROW_IF_UNINITIALIZED;
+        _state = jl_gc_unsafe_enter(jl_current_task->ptls);
+    }
+
+    GCUnsafeRegion::~GCUnsafeRegion()
+    {
+        jl_gc_unsafe_leave(jl_current_task->ptls, _state);
+    }
+}
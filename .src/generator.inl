@@ -0,0 +1,110 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 02.03.22 by clem (mail@clemens-cords.com)
+//
+
+#include <.c_adapter/c_adapter.hpp>
+#include <.src/common.hpp>
+
+namespace jluna
+{
+    template<Boxable V>
+    Generator<V>::Generator(std::function<std::optional<V>()>&& next, size_t batch_size)
+    {
+        _id = c_adapter::register_generator([next = std::move(next), done = false](jl_value_t* buffer) mutable -> size_t {
+
+            auto* array = (jl_array_t*) buffer;
+            size_t capacity = jl_array_len(array);
+            size_t n = 0;
+
+            while (not done and n < capacity)
+            {
+                auto value = next();
+                if (not value.has_value())
+                {
+                    done = true;
+                    break;
+                }
+
+                if constexpr (IsJuliaBits<V>)
+                    reinterpret_cast<V*>(jl_array_data(array))[n] = value.value();
+                else
+                    jl_arrayset(array, box(std::move(value.value())), n);
+
+                n += 1;
+            }
+
+            return n;
+        });
+
+        create(batch_size);
+    }
+
+    template<Boxable V>
+    Generator<V>::Generator(std::function<size_t(V*, size_t)>&& fill, size_t batch_size) requires IsJuliaBits<V>
+    {
+        _id = c_adapter::register_generator([fill = std::move(fill), done = false](jl_value_t* buffer) mutable -> size_t {
+
+            if (done)
+                return 0;
+
+            auto* array = (jl_array_t*) buffer;
+            size_t n = fill(reinterpret_cast<V*>(jl_array_data(array)), jl_array_len(array));
+
+            assert(n <= jl_array_len(array));
+            done = n == 0;
+            return n;
+        });
+
+        create(batch_size);
+    }
+
+    template<Boxable V>
+    void Generator<V>::create(size_t batch_size)
+    {
+        THROW_IF_UNINITIALIZED;
+        assert(batch_size > 0);
+
+        jl_function_t* new_generator = detail::cached([&]() -> jl_function_t* { return get_function("jluna.iterator_handler", "new_generator"); });
+
+        jl_value_t* type;
+        if constexpr (IsJuliaBits<V>)
+            type = (jl_value_t*) to_julia_type<V>();
+        else
+            type = (jl_value_t*) jl_any_type;
+
+        auto before = jl_gc_is_enabled();
+        jl_gc_enable(false);
+
+        try
+        {
+            _iterable = Proxy<State>(safe_call(new_generator, jl_box_uint64(_id), type, jl_box_uint64(batch_size)), nullptr);
+        }
+        catch (...)
+        {
+            jl_gc_enable(before);
+            c_adapter::unregister_generator(_id);
+            throw;
+        }
+
+        jl_gc_enable(before);
+    }
+
+    template<Boxable V>
+    Generator<V>::~Generator()
+    {
+        c_adapter::unregister_generator(_id);
+    }
+
+    template<Boxable V>
+    Generator<V>::operator jl_value_t*()
+    {
+        return (jl_value_t*) _iterable;
+    }
+
+    template<Boxable V>
+    Proxy<State> Generator<V>::as_proxy()
+    {
+        return _iterable;
+    }
+}
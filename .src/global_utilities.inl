@@ -22,7 +22,7 @@ namespace jluna
     std::string to_string(jl_value_t* value)
     {
         THROW_IF_UNINITIALIZED;
-        static jl_function_t* string = jl_get_function(jl_base_module, "string");
+        jl_function_t* string = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "string"); });
         return std::string(jl_string_data(jl_call1(string, value)));
     }
 }
\ No newline at end of file
@@ -0,0 +1,171 @@
+#
+# Copyright 2022 Clemens Cords
+# Created on 23.02.2022 by clem (mail@clemens-cords.com)
+#
+begin # included into module jluna
+
+    """
+    offers julia-side access to lock-free ring buffers owned by C++ jluna::Channel
+    """
+    module channel_handler
+
+        const _enqueue_index = 1
+        const _dequeue_index = 9
+        const _closed_index = 17
+
+        """
+        bounded lock-free ring buffer, memory is owned C++-side. Isbits values are
+        stored in C++ memory directly, all other values in a julia-side Vector{Any}
+
+        _positions: enqueue position, dequeue position and closed flag, each on their own cache line
+        _sequences: per-slot sequence numbers
+        _values: Ptr{T} for isbits T, Vector{Any} otherwise
+        """
+        mutable struct RingChannel{T, Values_t} <: AbstractChannel{T}
+
+            _positions::Ptr{UInt64}
+            _sequences::Ptr{UInt64}
+            _values::Values_t
+            _mask::UInt64
+        end
+
+        """
+        new_ring_channel(::Type, positions::UInt64, sequences::UInt64, values::UInt64, capacity::UInt64) -> RingChannel
+
+        wrap memory allocated C++-side, values is ignored for non-isbits types
+        """
+        function new_ring_channel(T::Type, positions::UInt64, sequences::UInt64, values::UInt64, capacity::UInt64) ::RingChannel
+
+            if isbitstype(T)
+                return RingChannel{T, Ptr{T}}(Ptr{UInt64}(positions), Ptr{UInt64}(sequences), Ptr{T}(values), capacity - 1)
+            else
+                return RingChannel{Any, Vector{Any}}(Ptr{UInt64}(positions), Ptr{UInt64}(sequences), Vector{Any}(nothing, capacity), capacity - 1)
+            end
+        end
+
+        _load(p::Ptr{UInt64}, i::Integer) = Core.Intrinsics.atomic_pointerref(p + (i - 1) * sizeof(UInt64), :acquire)
+        _store!(p::Ptr{UInt64}, i::Integer, x::UInt64) = Core.Intrinsics.atomic_pointerset(p + (i - 1) * sizeof(UInt64), x, :release)
+        _replace!(p::Ptr{UInt64}, i::Integer, expected::UInt64, desired::UInt64) = Core.Intrinsics.atomic_pointerreplace(p + (i - 1) * sizeof(UInt64), expected, desired, :acquire_release, :monotonic)[2]
+
+        _get_value(values::Ptr{T}, i::UInt64) where T = unsafe_load(values, i + 1)
+        _get_value(values::Vector{Any}, i::UInt64) = (x = values[i + 1]; values[i + 1] = nothing; x)
+
+        _set_value!(values::Ptr{T}, i::UInt64, x) where T = unsafe_store!(values, convert(T, x), i + 1)
+        _set_value!(values::Vector{Any}, i::UInt64, x) = (values[i + 1] = x)
+
+        """
+        try_put!(::RingChannel, x) -> Bool
+
+        push without blocking, returns false if the channel is full
+        """
+        function try_put!(channel::RingChannel, x) ::Bool
+
+            isopen(channel) || throw(InvalidStateException("Channel is closed.", :closed))
+
+            position = _load(channel._positions, _enqueue_index)
+            while true
+
+                slot = position & channel._mask
+                difference = reinterpret(Int64, _load(channel._sequences, slot + 1)) - reinterpret(Int64, position)
+
+                if difference == 0
+                    _replace!(channel._positions, _enqueue_index, position, position + 1) && break
+                    position = _load(channel._positions, _enqueue_index)
+                elseif difference < 0
+                    return false
+                else
+                    position = _load(channel._positions, _enqueue_index)
+                end
+            end
+
+            _set_value!(channel._values, position & channel._mask, x)
+            _store!(channel._sequences, (position & channel._mask) + 1, position + 1)
+            return true
+        end
+
+        """
+        try_take!(::RingChannel) -> Tuple{Bool, Any}
+
+        pop without blocking, returns (false, nothing) if the channel is empty
+        """
+        function try_take!(channel::RingChannel{T}) ::Tuple{Bool, Union{T, Nothing}} where T
+
+            position = _load(channel._positions, _dequeue_index)
+            while true
+
+                slot = position & channel._mask
+                difference = reinterpret(Int64, _load(channel._sequences, slot + 1)) - reinterpret(Int64, position + 1)
+
+                if difference == 0
+                    _replace!(channel._positions, _dequeue_index, position, position + 1) && break
+                    position = _load(channel._positions, _dequeue_index)
+                elseif difference < 0
+                    return (false, nothing)
+                else
+                    position = _load(channel._positions, _dequeue_index)
+                end
+            end
+
+            value = _get_value(channel._values, position & channel._mask)
+            _store!(channel._sequences, (position & channel._mask) + 1, position + channel._mask + 1)
+            return (true, value)
+        end
+
+        """
+        put!(::RingChannel, x) -> typeof(x)
+
+        push, yield to other tasks while the channel is full
+        """
+        function Base.put!(channel::RingChannel, x)
+
+            while !try_put!(channel, x)
+                yield()
+            end
+            return x
+        end
+
+        """
+        take!(::RingChannel) -> T
+
+        pop, yield to other tasks while the channel is empty. Throws InvalidStateException once the channel is closed and empty
+        """
+        function Base.take!(channel::RingChannel)
+
+            while true
+                success, value = try_take!(channel)
+                success && return value
+                isopen(channel) || isready(channel) || throw(InvalidStateException("Channel is closed.", :closed))
+                yield()
+            end
+        end
+
+        """
+        isready(::RingChannel) -> Bool
+
+        whether at least one value is available
+        """
+        function Base.isready(channel::RingChannel) ::Bool
+
+            position = _load(channel._positions, _dequeue_index)
+            return _load(channel._sequences, (position & channel._mask) + 1) == position + 1
+        end
+
+        Base.isopen(channel::RingChannel) = _load(channel._positions, _closed_index) == 0
+        Base.close(channel::RingChannel) = (_store!(channel._positions, _closed_index, UInt64(1)); nothing)
+        Base.eltype(::RingChannel{T}) where T = T
+
+        function Base.iterate(channel::RingChannel, state = nothing)
+
+            try
+                return (take!(channel), nothing)
+            catch e
+                if e isa InvalidStateException && e.state === :closed
+                    return nothing
+                else
+                    rethrow()
+                end
+            end
+        end
+        Base.IteratorSize(::Type{<:RingChannel}) = Base.SizeUnknown()
+    end
+end
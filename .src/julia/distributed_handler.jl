@@ -0,0 +1,85 @@
+#
+# Copyright 2022 Clemens Cords
+# Created on 27.02.2022 by clem (mail@clemens-cords.com)
+#
+begin # included into module jluna
+
+    """
+    offers access to pools of local worker processes for C++ jluna::WorkerPool. Distributed and SharedArrays
+    are only loaded once the first pool is created, so they are accessed through Main at runtime
+    """
+    module distributed_handler
+
+        """
+        arrays of isbits types with at least this many elements are handed to workers through shared memory
+        """
+        const _share_threshold = 1024
+
+        """
+        new_worker_pool(n::UInt64) -> Distributed.WorkerPool
+
+        start n local worker processes and bundle them into a pool
+        """
+        function new_worker_pool(n::UInt64)
+
+            ids = Main.Distributed.addprocs(Int64(n))
+            Main.Distributed.remotecall_eval(Main, ids, :(import Distributed, SharedArrays))
+            return Main.Distributed.WorkerPool(ids)
+        end
+
+        """
+        remove_worker_pool(::Distributed.WorkerPool) -> Nothing
+
+        shut down all worker processes of a pool
+        """
+        function remove_worker_pool(pool) ::Nothing
+
+            Main.Distributed.rmprocs(Main.Distributed.workers(pool)...)
+            return nothing
+        end
+
+        """
+        script(::Distributed.WorkerPool, code::String) -> Nothing
+
+        evaluate code in Main of the calling process and all workers of the pool, equivalent to @everywhere
+        """
+        function script(pool, code::String) ::Nothing
+
+            expr = Meta.parse("begin " * code * " end")
+            expr.head = :toplevel
+
+            Core.eval(Main, expr)
+            Main.Distributed.remotecall_eval(Main, Main.Distributed.workers(pool), expr)
+            return nothing
+        end
+
+        """
+        share(::Distributed.WorkerPool, ::Array) -> SharedArray
+
+        copy array into shared memory mapped by the calling process and all workers of the pool
+        """
+        function share(pool, array::Array{T}) where T
+
+            @assert isbitstype(T) "only arrays of isbits types can be shared"
+
+            ids = vcat(Main.Distributed.myid(), Main.Distributed.workers(pool))
+            shared = Main.SharedArrays.SharedArray{T}(size(array); pids = ids)
+            copyto!(shared, array)
+            return shared
+        end
+
+        _maybe_share(pool, x) = x
+        _maybe_share(pool, x::Array{T}) where T = (isbitstype(T) && length(x) >= _share_threshold) ? share(pool, x) : x
+
+        """
+        remote_call(::Distributed.WorkerPool, f, args...) -> Any
+
+        call f on the least busy worker of the pool, large isbits arrays are copied into shared memory instead of being serialized.
+        The copy is made on every call, arrays handed to many calls should be shared once through `share` instead
+        """
+        function remote_call(pool, f, args...)
+
+            return Main.Distributed.remotecall_fetch(f, pool, map(x -> _maybe_share(pool, x), args)...)
+        end
+    end
+end
@@ -28,7 +28,17 @@ begin # included into module jluna
             _last_message::String
         end
 
-        const _state = Ref{State}(State(NoException(), ""));
+        """
+        get_state() -> State
+
+        access state of the exception handler, each task and therefore each C++ thread has its own
+        """
+        function get_state() ::State
+
+            return get!(task_local_storage(), :jluna_exception_state) do
+                State(NoException(), "")
+            end
+        end
         _meta_exception_message = ""
 
         """
@@ -95,8 +105,9 @@ begin # included into module jluna
         function update(exception::Exception) ::Nothing
 
             try
-            global _state[]._last_message = sprint(Base.showerror, exception, catch_backtrace())
-            global _state[]._last_exception = exception
+            state = get_state()
+            state._last_message = sprint(Base.showerror, exception, catch_backtrace())
+            state._last_exception = exception
             catch e end
             return nothing
         end
@@ -108,8 +119,9 @@ begin # included into module jluna
         """
         function update() ::Nothing
 
-            global _state[]._last_message = ""
-            global _state[]._last_exception = NoException()
+            state = get_state()
+            state._last_message = ""
+            state._last_exception = NoException()
             return nothing
         end
 
@@ -120,7 +132,7 @@ begin # included into module jluna
         """
         function has_exception_occurred() ::Bool
 
-            return typeof(_state[]._last_exception) != NoException
+            return typeof(get_state()._last_exception) != NoException
         end
 
         """
@@ -129,14 +141,41 @@ begin # included into module jluna
         get last exception stacktrace
         """
         function get_last_message() ::String
-            return _state[]._last_message
+            return get_state()._last_message
         end
 
         """
         get_last_exception() -> Exception
         """
         function get_last_exception() ::Exception
-            return _state[]._last_exception
+            return get_state()._last_exception
+        end
+
+        """
+        has_interrupt_occurred() -> Bool
+
+        is last exception an InterruptException, used by C++ to detect calls that were interrupted because their deadline expired
+        """
+        function has_interrupt_occurred() ::Bool
+            return get_state()._last_exception isa InterruptException
+        end
+
+        """
+        absorb_interrupt() -> Nothing
+
+        wait for an interrupt that was sent but not yet delivered, then discard it. Returns as soon as it arrived, or after 50ms if it never does
+        """
+        function absorb_interrupt() ::Nothing
+
+            try
+                for _ in 1:50
+                    sleep(0.001)
+                end
+            catch exc
+                exc isa InterruptException || rethrow()
+            end
+
+            return nothing
         end
     end
 end
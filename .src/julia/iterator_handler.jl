@@ -0,0 +1,107 @@
+#
+# Copyright 2022 Clemens Cords
+# Created on 01.03.2022 by clem (mail@clemens-cords.com)
+#
+begin # included into module jluna
+
+    """
+    offers batched iteration between julia iterables and C++ jluna::Stream, as well as C++ jluna::Generator
+    """
+    module iterator_handler
+
+        """
+        iteration state of an arbitrary iterable, advanced by C++ one batch at a time
+        """
+        mutable struct Stream
+
+            iterable::Any
+            state::Any
+            started::Bool
+            done::Bool
+
+            Stream(iterable) = new(iterable, nothing, false, false)
+        end
+
+        """
+        new_stream(iterable) -> Stream
+        """
+        new_stream(iterable) = Stream(iterable)
+
+        """
+        next_batch(::Stream, T::Type, n::UInt64) -> Vector{T}
+
+        advance iteration by up to n elements and collect them converted to T. If less than n elements are returned, the stream is exhausted
+        """
+        function next_batch(stream::Stream, ::Type{T}, n::UInt64) ::Vector{T} where T
+
+            out = Vector{T}()
+            sizehint!(out, n)
+
+            while length(out) < n && !stream.done
+
+                next = stream.started ? iterate(stream.iterable, stream.state) : iterate(stream.iterable)
+                stream.started = true
+
+                if next === nothing
+                    stream.done = true
+                    break
+                end
+
+                push!(out, next[1])
+                stream.state = next[2]
+            end
+
+            return out
+        end
+
+        """
+        iterable over a C++-side generator, each call into C++ fills the buffer with up to length(buffer) elements
+        """
+        struct CppGenerator{T}
+
+            id::UInt64
+            buffer::Vector{T}
+        end
+
+        Base.IteratorSize(::Type{<:CppGenerator}) = Base.SizeUnknown()
+        Base.eltype(::Type{CppGenerator{T}}) where T = T
+
+        """
+        new_generator(id::UInt64, T::Type, batch_size::UInt64) -> CppGenerator{T}
+        """
+        new_generator(id::UInt64, ::Type{T}, batch_size::UInt64) where T = CppGenerator{T}(id, Vector{T}(undef, batch_size))
+
+        """
+        fill_buffer!(::CppGenerator) -> Int64
+
+        refill buffer by calling into C++, returns number of elements written, 0 once the generator is exhausted
+        """
+        function fill_buffer!(generator::CppGenerator) ::Int64
+
+            n = ccall((:invoke_generator, Main._cppcall._library_name), Csize_t, (Csize_t, Any), generator.id, generator.buffer)
+
+            if n == typemax(Csize_t)
+                message = unsafe_string(ccall((:get_generator_error, Main._cppcall._library_name), Cstring, ()))
+                throw(ErrorException("in C++ generator: " * message))
+            end
+
+            return Int64(n)
+        end
+
+        function Base.iterate(generator::CppGenerator, state::Tuple{Int64, Int64} = (0, 0))
+
+            index, n = state
+
+            if index >= n
+                n = fill_buffer!(generator)
+                index = 0
+
+                if n == 0
+                    return nothing
+                end
+            end
+
+            return (generator.buffer[index + 1], (index + 1, n))
+        end
+    end
+end
@@ -12,12 +12,11 @@ begin # included into module jluna
     """
     module memory_handler
 
-        _current_id = UInt64(0);
+        const _current_id = Threads.Atomic{UInt64}(0);
+        const _lock = ReentrantLock()
         const _refs = Ref(Dict{UInt64, Base.RefValue{Any}}())
         const _ref_counter = Ref(IdDict{UInt64, UInt64}())
 
-        const _ref_id_marker = '#'
-
         """
         print_refs() -> Nothing
 
@@ -42,17 +41,18 @@ begin # included into module jluna
                 return 0;
             end
 
-            global _current_id += 1;
-            key = _current_id;
+            key = Threads.atomic_add!(_current_id, UInt64(1)) + 1;
 
             #println("[JULIA] allocated " * string(key) * " (" * Base.string(to_wrap) * ")")
 
-            if (haskey(_refs[], key))
-                @assert _refs[][key].x == to_wrap && typeof(to_wrap) == typeof(_refs[][key].x)
-                _ref_counter[][key] += 1
-            else
-                _refs[][key] = Base.RefValue{Any}(to_wrap)
-                _ref_counter[][key] = 1
+            lock(_lock) do
+                if (haskey(_refs[], key))
+                    @assert _refs[][key].x == to_wrap && typeof(to_wrap) == typeof(_refs[][key].x)
+                    _ref_counter[][key] += 1
+                else
+                    _refs[][key] = Base.RefValue{Any}(to_wrap)
+                    _ref_counter[][key] = 1
+                end
             end
 
             return key;
@@ -65,64 +65,49 @@ begin # included into module jluna
         """
         function set_reference(key::UInt64, new_value::T) ::Base.RefValue{Any} where T
 
-            _refs[][key] = Base.RefValue{Any}(new_value)
-            return _refs[][key]
+            return lock(_lock) do
+                _refs[][key] = Base.RefValue{Any}(new_value)
+            end
         end
 
         """
-        """
-        function assign(new_value::T, names::Symbol...) ::T where T
-
-            unnamed_to_index(s::Symbol) = tryparse(UInt64, chop(string(s), head = 1, tail = 0))
-
-            name = "";
-
-            in_main = false;
+        evaluate(root::Any, path::Union{Symbol, Integer}...) -> Any
 
-            for n in names
-
-                as_string = string(n);
-                if as_string[1] == _ref_id_marker
-                    if as_string[2] == '1' && length(as_string) == 2 # main
-                        in_main = true
-                        continue
-                    else
-                        name *= "jluna.memory_handler._refs[][" * chop(string(n), head = 1, tail = 0) * "][]"
-                    end
-                elseif as_string[1] == '['
-                    name *= string(n)
-                else
-                    name *= "." * string(n)
-                end
-            end
+        follow a proxy path starting at root, each Symbol accesses a field, each Integer an index
+        """
+        function evaluate(root::Any, path::Union{Symbol, Integer}...) ::Any
 
-            if in_main
-                name = chop(name, head = 1, tail = 0)   # remove first .
+            current = root
+            for segment in path
+                current = segment isa Symbol ? getproperty(current, segment) : current[segment]
             end
 
-            Main.eval(:($(Meta.parse(name)) = $new_value));
-            return new_value;
+            return current
         end
 
         """
+        assign(::T, root::Any, path::Union{Symbol, Integer}...) -> T
+
+        assign to the variable, field or element at the end of a proxy path starting at root
         """
-        function evaluate(names::Symbol...) ::Any
+        function assign(new_value::T, root::Any, path::Union{Symbol, Integer}...) ::T where T
 
-            name = "";
+            if isempty(path)
+                return new_value    # unnamed, only the reference itself changes
+            end
 
-            for n in names
+            owner = evaluate(root, path[1:end-1]...)
+            last = path[end]
 
-                as_string = string(n);
-                if as_string[1] == _ref_id_marker
-                    name *= "jluna.memory_handler._refs[][" * chop(string(n), head = 1, tail = 0) * "][]"
-                elseif as_string[1] == '['
-                    name *= string(n)
-                else
-                    name *= "." * string(n)
-                end
+            if last isa Integer
+                setindex!(owner, new_value, last)
+            elseif owner isa Module
+                Core.eval(owner, Expr(:(=), last, QuoteNode(new_value)))
+            else
+                setproperty!(owner, last, new_value)
             end
 
-            return Main.eval(:($(Meta.parse(name))))
+            return new_value;
         end
 
         """
@@ -134,7 +119,9 @@ begin # included into module jluna
                 return nothing
             end
 
-           return _refs[][key]
+            return lock(_lock) do
+                _refs[][key]
+            end
         end
 
         """
@@ -148,20 +135,100 @@ begin # included into module jluna
                 return nothing;
             end
 
-            @assert haskey(_refs[], key)
-            #println("[JULIA] freed " * string(key) * " (" * Base.string(typeof(_refs[][key].x)) * ")")
+            lock(_lock) do
+                @assert haskey(_refs[], key)
+                #println("[JULIA] freed " * string(key) * " (" * Base.string(typeof(_refs[][key].x)) * ")")
+
+                _ref_counter[][key] -= 1
+                count = _ref_counter[][key]
+
+                if (count == 0)
+                    delete!(_ref_counter[], key)
+                    delete!(_refs[], key)
+                end
+            end
+
+            return nothing;
+        end
+
+        """
+        add_to_frame(::Vector{Any}, ::Any) -> Base.RefValue{Any}
+
+        root value in a frame instead of _refs, the frame itself is held in _refs and released in one piece
+        """
+        function add_to_frame(frame::Vector{Any}, to_wrap::Any) ::Base.RefValue{Any}
+
+            ref = Base.RefValue{Any}(to_wrap)
+            push!(frame, ref)
+            return ref
+        end
 
-            global _ref_counter[][key] -= 1
-            count = _ref_counter[][key]
+        """
+        free_references(::Vector{UInt64}) -> Nothing
+
+        free multiple references from _refs in one call, used by C++ to flush its queue of released proxies
+        """
+        function free_references(keys::Vector{UInt64}) ::Nothing
 
-            if (count == 0)
-                delete!(_ref_counter[], key)
-                delete!(_refs[], key)
+            lock(_lock) do
+                for key in keys
+                    free_reference(key)
+                end
             end
 
             return nothing;
         end
 
+        const _allocations = Dict{UInt64, Vector}()
+
+        """
+        allocate(T::Type, n::UInt64) -> UInt64
+
+        allocate vector for C++ jluna::allocator, it stays rooted until deallocate is called. Returns pointer to its memory
+        """
+        function allocate(T::Type, n::UInt64) ::UInt64
+
+            vector = Vector{T}(undef, n)
+            ptr = UInt64(pointer(vector))
+
+            lock(_lock) do
+                _allocations[ptr] = vector
+            end
+
+            return ptr
+        end
+
+        """
+        deallocate(ptr::UInt64) -> Nothing
+
+        unroot vector allocated by allocate, julia-side references to it stay valid
+        """
+        function deallocate(ptr::UInt64) ::Nothing
+
+            lock(_lock) do
+                delete!(_allocations, ptr)
+            end
+
+            return nothing
+        end
+
+        """
+        wrap_allocation(ptr::UInt64, n::UInt64) -> Vector
+
+        get first n elements of vector allocated by allocate, without copying. The result keeps the allocation alive.
+        It is always a new array sharing the allocations memory, never the rooted vector itself, so resizing it julia-side
+        moves its data to a new buffer rather than reallocating the memory C++ still points to
+        """
+        function wrap_allocation(ptr::UInt64, n::UInt64) ::Vector
+
+            vector = lock(_lock) do
+                _allocations[ptr]
+            end
+
+            @assert n <= length(vector)
+            return ccall(:jl_reshape_array, Any, (Any, Any, Any), typeof(vector), vector, (Int64(n),))
+        end
+
         """
         force_free() -> Nothing
 
@@ -169,9 +236,11 @@ begin # included into module jluna
         """
         function force_free() ::Nothing
 
-            for k in keys(_refs)
-                delete!(_refs[], k)
-                delete!(_ref_counter[], k)
+            lock(_lock) do
+                for k in keys(_refs)
+                    delete!(_refs[], k)
+                    delete!(_ref_counter[], k)
+                end
             end
 
             @assert isempty(_refs) && isempty(_ref_counter)
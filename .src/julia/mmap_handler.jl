@@ -0,0 +1,36 @@
+#
+# Copyright 2022 Clemens Cords
+# Created on 28.02.2022 by clem (mail@clemens-cords.com)
+#
+begin # included into module jluna
+
+    """
+    offers memory-mapped arrays for C++ jluna::mmap_array
+    """
+    module mmap_handler
+
+        import Mmap
+
+        """
+        mmap_array(path::String, create::Bool, T::Type, dims::UInt64...) -> Array{T, length(dims)}
+
+        map file into memory as an array of isbits type T. If create is set, the file is created if it does not exist
+        and grown to fit the array, an existing file is never truncated. The mapping is shared with all other processes
+        mapping the same file and is unmapped once the array is garbage collected
+        """
+        function mmap_array(path::String, create::Bool, T::Type, dims::UInt64...) ::Array
+
+            @assert isbitstype(T) "only arrays of isbits types can be memory-mapped"
+
+            n_bytes = prod(Int64.(dims); init = 1) * sizeof(T)
+
+            if !create && filesize(path) < n_bytes
+                throw(ArgumentError("file " * path * " is too small to hold an array of " * string(n_bytes) * " bytes"))
+            end
+
+            return open(path; read = true, write = true, create = create, truncate = false) do io
+                Mmap.mmap(io, Array{T, length(dims)}, Int64.(dims); shared = true)
+            end
+        end
+    end
+end
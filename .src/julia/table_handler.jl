@@ -0,0 +1,40 @@
+#
+# Copyright 2022 Clemens Cords
+# Created on 02.03.2022 by clem (mail@clemens-cords.com)
+#
+begin # included into module jluna
+
+    """
+    offers exchange of column tables, NamedTuples of Vectors, with C++ jluna::box_columns and jluna::unbox_columns
+    """
+    module table_handler
+
+        """
+        new_table(names::Vector{Symbol}, columns::AbstractVector...) -> NamedTuple
+
+        bundle columns into a column table, columns of element type Any are narrowed to the type of their elements
+        """
+        function new_table(names::Vector{Symbol}, columns::AbstractVector...) ::NamedTuple
+
+            if !isempty(columns) && any(column -> length(column) != length(first(columns)), columns)
+                throw(ArgumentError("all columns of a table need to have the same length"))
+            end
+
+            narrowed = map(column -> eltype(column) === Any ? [x for x in column] : column, columns)
+            return NamedTuple{Tuple(names)}(narrowed)
+        end
+
+        """
+        get_columns(table, names::Vector{Symbol}, types::Type...) -> Tuple
+
+        get columns of any object with named columns accessible through getproperty, such as a NamedTuple of vectors.
+        Columns of isbits types are converted to a Vector of that type, copying only if necessary, all others are collected into a Vector
+        """
+        function get_columns(table, names::Vector{Symbol}, types::Type...) ::Tuple
+
+            return Tuple(_get_column(getproperty(table, name), T) for (name, T) in zip(names, types))
+        end
+
+        _get_column(column, ::Type{T}) where T = isbitstype(T) ? convert(Vector{T}, column) : (column isa Vector ? column : collect(column))
+    end
+end
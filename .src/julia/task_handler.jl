@@ -0,0 +1,133 @@
+#
+# Copyright 2022 Clemens Cords
+# Created on 20.02.22 by clem (mail@clemens-cords.com)
+#
+begin # included into module jluna
+
+    """
+    runs calls as julia tasks on behalf of C++, once a task finishes the
+    C++-side callback registered under the tasks id is invoked
+    """
+    module task_handler
+
+        """
+        schedule_call(id::UInt64, spawn::Bool, f::Any, args...) -> Task
+
+        call f(args...) in a new task. If spawn is true, the task may run on any thread of the thread pool,
+        otherwise it is bound to the calling thread. Once done, invoke the C++ callback with a tuple
+        (result, exception, message), where exception is nothing if no exception occurred
+        """
+        function schedule_call(id::UInt64, spawn::Bool, f::Any, args...) ::Task
+
+            task = Task() do
+
+                result = nothing
+                exception = nothing
+                message = ""
+
+                try
+                    result = f(args...)
+                catch exc
+                    exception = exc
+                    message = sprint(Base.showerror, exc, catch_backtrace())
+                end
+
+                ccall((:invoke_callback, Main._cppcall._library_name), Cvoid, (Csize_t, Any), id, (result, exception, message))
+            end
+
+            task.sticky = !spawn
+            schedule(task)
+            return task
+        end
+
+        """
+        poll(budget::UInt64) -> UInt64
+
+        advance the libuv event loop and run up to budget tasks runnable on the calling thread, returns the number of tasks run
+        """
+        function poll(budget::UInt64) ::UInt64
+
+            n = UInt64(0)
+            while n < budget
+
+                Base.process_events()
+
+                if isempty(Base.workqueue_for(Threads.threadid()))
+                    break
+                end
+
+                yield()
+                n += 1
+            end
+
+            return n
+        end
+
+        """
+        run_for(duration_ns::UInt64) -> Nothing
+
+        advance the libuv event loop and run tasks on the calling thread for the given duration. While no task is runnable, the thread sleeps in the event loop, so timers and I/O callbacks still fire
+        """
+        function run_for(duration_ns::UInt64) ::Nothing
+
+            deadline = time_ns() + duration_ns
+            while (now = time_ns()) < deadline
+
+                Base.process_events()
+
+                if isempty(Base.workqueue_for(Threads.threadid()))
+                    sleep(0.001)    # shortest timer libuv supports, may overshoot the deadline by as much
+                else
+                    yield()
+                end
+            end
+
+            return nothing
+        end
+
+        """
+        _chunks(::AbstractArray, n_chunks::Integer) -> Iterator
+
+        split the indices of an array into at most n_chunks contiguous ranges, if n_chunks is 0, 4 chunks per thread are used so idle threads can steal work
+        """
+        function _chunks(array::AbstractArray, n_chunks::Integer)
+
+            n_chunks = n_chunks == 0 ? 4 * Threads.nthreads() : n_chunks
+            return Iterators.partition(eachindex(array), max(1, cld(length(array), n_chunks)))
+        end
+
+        """
+        parallel_map(f, ::AbstractArray, n_chunks::Integer) -> Array
+
+        apply f to every element, distributing chunks of the array over the thread pool. The result has the same shape as the input
+        """
+        function parallel_map(f, array::AbstractArray, n_chunks::Integer) ::Array
+
+            if isempty(array)
+                return similar(array, Any)
+            end
+
+            tasks = [Threads.@spawn map(i -> f(@inbounds array[i]), chunk) for chunk in _chunks(array, n_chunks)]
+            return reshape(reduce(vcat, fetch.(tasks)), size(array))
+        end
+
+        """
+        parallel_for(f, ::AbstractArray, n_chunks::Integer) -> Nothing
+
+        call f on every element for its side effects, distributing chunks of the array over the thread pool
+        """
+        function parallel_for(f, array::AbstractArray, n_chunks::Integer) ::Nothing
+
+            tasks = [Threads.@spawn foreach(i -> f(@inbounds array[i]), chunk) for chunk in _chunks(array, n_chunks)]
+            foreach(wait, tasks)
+            return nothing
+        end
+
+        """
+        cppcall_wrapper(::Symbol) -> Function
+
+        wrap a C++ function registered as function_name so it can be handed to parallel_map and parallel_for
+        """
+        cppcall_wrapper(function_name::Symbol) = x -> Main.cppcall(function_name, x)
+    end
+end
@@ -0,0 +1,40 @@
+#
+# Copyright 2022 Clemens Cords
+# Created on 03.03.2022 by clem (mail@clemens-cords.com)
+#
+begin # included into module jluna
+
+    """
+    offers memory layouts of non-Array AbstractArrays for C++ jluna::StridedView and jluna::Range
+    """
+    module view_handler
+
+        """
+        strided_layout(::AbstractArray, T::Type, N::Integer) -> Tuple{UInt64, NTuple{N, UInt64}, NTuple{N, Int64}}
+
+        get pointer to the first element, size and strides in elements of any StridedArray{T, N}, such as a SubArray or ReshapedArray of an Array
+        """
+        function strided_layout(x::AbstractArray, ::Type{T}, N::Integer) ::Tuple where T
+
+            if !(x isa StridedArray)
+                throw(ArgumentError("array of type " * string(typeof(x)) * " is not strided"))
+            end
+
+            if eltype(x) !== T || ndims(x) != N
+                throw(ArgumentError("expected strided array of element type " * string(T) * " and rank " * string(N) * ", got " * string(typeof(x))))
+            end
+
+            return (UInt64(pointer(x)), UInt64.(size(x)), Int64.(strides(x)))
+        end
+
+        """
+        range_layout(::AbstractRange, T::Type) -> Tuple{T, T, UInt64}
+
+        get first element, step and length of a range
+        """
+        function range_layout(x::AbstractRange, ::Type{T}) ::Tuple where T
+
+            return (convert(T, first(x)), convert(T, step(x)), UInt64(length(x)))
+        end
+    end
+end
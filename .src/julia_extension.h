@@ -6,6 +6,7 @@
 #pragma once
 
 #include <julia.h>
+#include <typedefs.hpp>
 
 //
 // this file adds functionality to julia.h, however it is not part of the julia C-API
@@ -13,8 +14,6 @@
 
 extern "C"
 {
-    const char jl_id_marker = '#';
-
     /// @brief unbox float16 by converting it to float32 first
     float jl_unbox_float16(jl_value_t* v)
     {
@@ -23,6 +22,27 @@ extern "C"
         return jl_unbox_float32(res);
     }
 
+    /// @brief check whether a value is permanently rooted julia-side: symbols, booleans, Main, Base, Core and singleton instances whose type or function name is a constant binding
+    bool jl_is_immortal(jl_value_t* v)
+    {
+        if (jl_is_symbol(v) or v == jl_true or v == jl_false)
+            return true;
+
+        if (v == (jl_value_t*) jl_main_module or v == (jl_value_t*) jl_base_module or v == (jl_value_t*) jl_core_module)
+            return true;
+
+        auto* type = (jl_datatype_t*) jl_typeof(v);
+        if (not jl_is_datatype(type) or type->instance != v)
+            return false;
+
+        // named functions are bound under the name of their method table, other singletons like nothing through their type
+        jl_typename_t* name = type->name;
+        if (name->mt != nullptr and jl_is_const(name->module, name->mt->name) and jl_get_global(name->module, name->mt->name) == v)
+            return true;
+
+        return jl_is_const(name->module, name->name) and jl_get_global(name->module, name->name) == name->wrapper;
+    }
+
     /// @brief get value type of array
     jl_datatype_t* jl_array_value_t(jl_array_t* v)
     {
@@ -33,14 +53,14 @@ extern "C"
     /// @brief return value as string
     char* jl_to_string(jl_value_t* v)
     {
-        static jl_function_t* to_string = jl_get_function(jl_main_module, "string");
+        jl_function_t* to_string = jluna::detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_main_module, "string"); });
         return jl_string_data(jl_call1(to_string, v));
     }
 
     /// @brief get value of reference
     jl_value_t* jl_ref_value(jl_value_t* reference)
     {
-        static jl_function_t* get_reference_value = jl_get_function((jl_module_t*) jl_eval_string("return jluna"), "get_reference_value");
+        jl_function_t* get_reference_value = jluna::detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return jluna"), "get_reference_value"); });
         return jl_call1(get_reference_value, reference);
     }
 
@@ -53,42 +73,42 @@ extern "C"
     /// @brief const char* to julia-side string
     jl_value_t* jl_string(const char* str)
     {
-        static jl_function_t* string = jl_get_function(jl_base_module, "string");
+        jl_function_t* string = jluna::detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "string"); });
         return jl_call1(string, (jl_value_t*) jl_symbol(str));
     }
 
     /// @brief get nth element of tuple
     jl_value_t* jl_tupleref(jl_value_t* tuple, size_t n)
     {
-        static jl_function_t* get = jl_get_function(jl_base_module, "get");
+        jl_function_t* get = jluna::detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "get"); });
         return jl_call3(get, tuple, jl_box_uint64(n + 1), jl_undef_initializer());
     }
 
     /// @brief get length of tuple
     size_t jl_tuple_len(jl_value_t* tuple)
     {
-        static jl_function_t* length = jl_get_function(jl_base_module, "length");
+        jl_function_t* length = jluna::detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "length"); });
         return jl_unbox_int64(jl_call1(length, tuple));
     }
 
     /// @brief hash julia-side
     size_t jl_hash(const char* str)
     {
-        static jl_function_t* hash = jl_get_function(jl_base_module, "hash");
+        jl_function_t* hash = jluna::detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "hash"); });
         return jl_unbox_uint64(jl_call1(hash, (jl_value_t*) jl_symbol(str)));
     }
 
     /// @brief get proper typeof as str
     const char* jl_verbose_typeof_str(jl_value_t* v)
     {
-        static jl_function_t* type_of = jl_get_function(jl_base_module, "typeof");
+        jl_function_t* type_of = jluna::detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "typeof"); });
         return jl_to_string(jl_call1(type_of, v));
     }
 
     /// @brief invoke deepcopy
     jl_value_t* jl_deepcopy(jl_value_t* in)
     {
-        static jl_function_t* deepcopy = jl_get_function(jl_base_module, "deepcopy");
+        jl_function_t* deepcopy = jluna::detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "deepcopy"); });
         return jl_call1(deepcopy, in);
     }
 }
@@ -0,0 +1,152 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 03.03.22 by clem (mail@clemens-cords.com)
+//
+
+#include <sstream>
+#include <stdexcept>
+
+#include <.src/common.hpp>
+
+namespace jluna
+{
+    template<typename V> requires IsJuliaBits<std::remove_const_t<V>>
+    MatrixView<V>::MatrixView(V* data, size_t n_rows, size_t n_cols, size_t leading_dimension)
+        : _data(data), _n_rows(n_rows), _n_cols(n_cols), _leading_dimension(leading_dimension == 0 ? n_rows : leading_dimension)
+    {
+        assert(_leading_dimension >= _n_rows);
+    }
+
+    template<typename V> requires IsJuliaBits<std::remove_const_t<V>>
+    MatrixView<V>::MatrixView(Array<value_type, 2>& array)
+        : MatrixView(
+            array.data(),
+            jl_array_dim((jl_array_t*) (jl_value_t*) array, 0),
+            jl_array_dim((jl_array_t*) (jl_value_t*) array, 1))
+    {}
+
+    template<typename V> requires IsJuliaBits<std::remove_const_t<V>>
+    V& MatrixView<V>::operator()(size_t row, size_t col) const
+    {
+        return _data[row + col * _leading_dimension];
+    }
+
+    template<typename V> requires IsJuliaBits<std::remove_const_t<V>>
+    V& MatrixView<V>::at(size_t row, size_t col) const
+    {
+        if (row >= _n_rows or col >= _n_cols)
+        {
+            std::stringstream str;
+            str << "0-based index (" << row << ", " << col << ") out of range for matrix of size (" << _n_rows << ", " << _n_cols << ")" << std::endl;
+            throw std::out_of_range(str.str().c_str());
+        }
+
+        return operator()(row, col);
+    }
+
+    template<typename V> requires IsJuliaBits<std::remove_const_t<V>>
+    constexpr size_t MatrixView<V>::rank()
+    {
+        return 2;
+    }
+
+    template<typename V> requires IsJuliaBits<std::remove_const_t<V>>
+    size_t MatrixView<V>::extent(size_t dimension) const
+    {
+        assert(dimension < 2);
+        return dimension == 0 ? _n_rows : _n_cols;
+    }
+
+    template<typename V> requires IsJuliaBits<std::remove_const_t<V>>
+    size_t MatrixView<V>::stride(size_t dimension) const
+    {
+        assert(dimension < 2);
+        return dimension == 0 ? 1 : _leading_dimension;
+    }
+
+    template<typename V> requires IsJuliaBits<std::remove_const_t<V>>
+    size_t MatrixView<V>::n_rows() const
+    {
+        return _n_rows;
+    }
+
+    template<typename V> requires IsJuliaBits<std::remove_const_t<V>>
+    size_t MatrixView<V>::n_cols() const
+    {
+        return _n_cols;
+    }
+
+    template<typename V> requires IsJuliaBits<std::remove_const_t<V>>
+    size_t MatrixView<V>::leading_dimension() const
+    {
+        return _leading_dimension;
+    }
+
+    template<typename V> requires IsJuliaBits<std::remove_const_t<V>>
+    size_t MatrixView<V>::size() const
+    {
+        return _n_rows * _n_cols;
+    }
+
+    template<typename V> requires IsJuliaBits<std::remove_const_t<V>>
+    V* MatrixView<V>::data() const
+    {
+        return _data;
+    }
+
+    template<typename V> requires IsJuliaBits<std::remove_const_t<V>>
+    bool MatrixView<V>::is_contiguous() const
+    {
+        return _leading_dimension == _n_rows or _n_cols <= 1;
+    }
+
+    template<typename V> requires IsJuliaBits<std::remove_const_t<V>>
+    MatrixView<V> MatrixView<V>::submatrix(size_t row, size_t col, size_t n_rows, size_t n_cols) const
+    {
+        if (row + n_rows > _n_rows or col + n_cols > _n_cols)
+        {
+            std::stringstream str;
+            str << "block of size (" << n_rows << ", " << n_cols << ") at 0-based index (" << row << ", " << col << ") out of range for matrix of size (" << _n_rows << ", " << _n_cols << ")" << std::endl;
+            throw std::out_of_range(str.str().c_str());
+        }
+
+        return MatrixView<V>(_data + row + col * _leading_dimension, n_rows, n_cols, _leading_dimension);
+    }
+
+    template<typename V> requires IsJuliaBits<std::remove_const_t<V>>
+    Proxy<State> MatrixView<V>::as_julia() const
+    {
+        THROW_IF_UNINITIALIZED;
+
+        auto* data = const_cast<value_type*>(_data);
+
+        if (is_contiguous())
+            return borrow<value_type, 2>(data, {_n_rows, _n_cols});
+
+        jl_function_t* view = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "view"); });
+        jl_function_t* colon = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, ":"); });
+
+        auto before = jl_gc_is_enabled();
+        jl_gc_enable(false);
+
+        // wrap all columns including their padding, then select the rows of the view. The result is a strided SubArray with strides (1, leading_dimension)
+        auto parent = detail::ptr_to_array<value_type, 2>(data, {_leading_dimension, _n_cols});
+        auto rows = jl_call2(colon, jl_box_int64(1), jl_box_int64(_n_rows));
+        auto all = jl_call0(jl_get_function(jl_base_module, "Colon"));
+
+        jl_value_t* result;
+        try
+        {
+            result = safe_call(view, parent, rows, all);
+        }
+        catch (...)
+        {
+            jl_gc_enable(before);
+            throw;
+        }
+
+        auto out = Proxy<State>(result, nullptr);
+        jl_gc_enable(before);
+        return out;
+    }
+}
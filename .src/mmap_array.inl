@@ -0,0 +1,37 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 28.02.22 by clem (mail@clemens-cords.com)
+//
+
+#include <.src/common.hpp>
+
+namespace jluna
+{
+    template<IsJuliaBits Value_t, size_t Rank>
+    Array<Value_t, Rank> mmap_array(const std::string& path, const std::array<size_t, Rank>& dims, bool create)
+    {
+        THROW_IF_UNINITIALIZED;
+
+        jl_function_t* mmap_array = detail::cached([&]() -> jl_function_t* { return get_function("jluna.mmap_handler", "mmap_array"); });
+
+        auto before = jl_gc_is_enabled();
+        jl_gc_enable(false);
+
+        jl_value_t* result;
+        try
+        {
+            result = std::apply([&](auto... dim) {
+                return safe_call(mmap_array, jl_cstr_to_string(path.c_str()), jl_box_bool(create), (jl_value_t*) to_julia_type<Value_t>(), jl_box_uint64(dim)...);
+            }, dims);
+        }
+        catch (...)
+        {
+            jl_gc_enable(before);
+            throw;
+        }
+
+        auto out = Array<Value_t, Rank>(result);
+        jl_gc_enable(before);
+        return out;
+    }
+}
@@ -0,0 +1,56 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 22.02.22 by clem (mail@clemens-cords.com)
+//
+
+namespace jluna
+{
+    template<typename T>
+    MPSCQueue<T>::MPSCQueue()
+    {
+        auto* stub = new Node();
+        _head.store(stub, std::memory_order_relaxed);
+        _tail = stub;
+    }
+
+    template<typename T>
+    MPSCQueue<T>::~MPSCQueue()
+    {
+        Node* node = _tail;
+        while (node != nullptr)
+        {
+            Node* next = node->next.load(std::memory_order_relaxed);
+            delete node;
+            node = next;
+        }
+    }
+
+    template<typename T>
+    void MPSCQueue<T>::push(T&& value)
+    {
+        auto* node = new Node();
+        node->value.emplace(std::move(value));
+
+        // after the exchange the node is reachable from head, but not yet from its predecessor. Until the second store
+        // the consumer sees the queue as ending at the predecessor
+        Node* previous = _head.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    template<typename T>
+    bool MPSCQueue<T>::try_pop(T& out)
+    {
+        Node* tail = _tail;
+        Node* next = tail->next.load(std::memory_order_acquire);
+
+        if (next == nullptr)
+            return false;
+
+        out = std::move(*next->value);
+        next->value.reset();
+
+        _tail = next;
+        delete tail;
+        return true;
+    }
+}
@@ -0,0 +1,109 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 04.03.22 by clem (mail@clemens-cords.com)
+//
+
+#include <algorithm>
+#include <execution>
+#include <numeric>
+#include <stdexcept>
+
+namespace jluna::numeric
+{
+    namespace detail
+    {
+        /// @brief view of the arrays memory, without calling into julia
+        template<IsJuliaBits Value_t, size_t Rank>
+        std::span<Value_t> as_span(Array<Value_t, Rank>& array)
+        {
+            return std::span<Value_t>(array.data(), jl_array_len((jl_array_t*) (jl_value_t*) array));
+        }
+
+        template<typename A, typename B>
+        void throw_if_length_mismatch(const std::span<A>& a, const std::span<B>& b)
+        {
+            if (a.size() != b.size())
+                throw std::invalid_argument("arrays need to be of the same length, got " + std::to_string(a.size()) + " and " + std::to_string(b.size()));
+        }
+    }
+
+    template<IsJuliaBits Value_t, size_t Rank>
+    detail::sum_t<Value_t> sum(Array<Value_t, Rank>& array)
+    {
+        auto span = detail::as_span(array);
+        return std::transform_reduce(std::execution::par_unseq, span.begin(), span.end(), detail::sum_t<Value_t>(0), std::plus<>(), [](Value_t x) {
+            return static_cast<detail::sum_t<Value_t>>(x);
+        });
+    }
+
+    template<IsJuliaBits Value_t, size_t Rank>
+    std::pair<Value_t, Value_t> minmax(Array<Value_t, Rank>& array)
+    {
+        auto span = detail::as_span(array);
+
+        if (span.empty())
+            throw std::invalid_argument("minmax of empty array");
+
+        auto [min, max] = std::minmax_element(std::execution::par_unseq, span.begin(), span.end());
+        return {*min, *max};
+    }
+
+    template<IsJuliaBits Value_t, size_t Rank>
+    Value_t dot(Array<Value_t, Rank>& a, Array<Value_t, Rank>& b)
+    {
+        auto a_span = detail::as_span(a);
+        auto b_span = detail::as_span(b);
+        detail::throw_if_length_mismatch(a_span, b_span);
+
+        return std::transform_reduce(std::execution::par_unseq, a_span.begin(), a_span.end(), b_span.begin(), Value_t(0));
+    }
+
+    template<IsJuliaBits Value_t, size_t Rank>
+    void fill(Array<Value_t, Rank>& array, Value_t value)
+    {
+        auto span = detail::as_span(array);
+        std::fill(std::execution::par_unseq, span.begin(), span.end(), value);
+    }
+
+    template<IsJuliaBits In_t, IsJuliaBits Out_t, size_t Rank, typename Function_t>
+        requires std::is_invocable_r_v<Out_t, Function_t, In_t>
+    void transform(Array<In_t, Rank>& in, Array<Out_t, Rank>& out, Function_t&& function)
+    {
+        auto in_span = detail::as_span(in);
+        auto out_span = detail::as_span(out);
+        detail::throw_if_length_mismatch(in_span, out_span);
+
+        std::transform(std::execution::par_unseq, in_span.begin(), in_span.end(), out_span.begin(), std::forward<Function_t>(function));
+    }
+
+    template<IsJuliaBits Value_t, size_t Rank, typename Function_t>
+        requires std::is_invocable_r_v<Value_t, Function_t, Value_t>
+    void transform(Array<Value_t, Rank>& array, Function_t&& function)
+    {
+        auto span = detail::as_span(array);
+        std::transform(std::execution::par_unseq, span.begin(), span.end(), span.begin(), std::forward<Function_t>(function));
+    }
+
+    template<IsJuliaBits Value_t, size_t Rank>
+    void sort(Array<Value_t, Rank>& array)
+    {
+        auto span = detail::as_span(array);
+        std::sort(std::execution::par_unseq, span.begin(), span.end());
+    }
+
+    template<IsJuliaBits Value_t, size_t Rank, typename Comparator_t>
+        requires std::is_invocable_r_v<bool, Comparator_t, Value_t, Value_t>
+    void sort(Array<Value_t, Rank>& array, Comparator_t&& comparator)
+    {
+        auto span = detail::as_span(array);
+        std::sort(std::execution::par_unseq, span.begin(), span.end(), std::forward<Comparator_t>(comparator));
+    }
+
+    template<IsJuliaBits In_t, IsJuliaBits Out_t, size_t Rank>
+    void convert(Array<In_t, Rank>& in, Array<Out_t, Rank>& out)
+    {
+        transform(in, out, [](In_t x) -> Out_t {
+            return static_cast<Out_t>(x);
+        });
+    }
+}
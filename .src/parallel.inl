@@ -0,0 +1,123 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 26.02.22 by clem (mail@clemens-cords.com)
+//
+
+#include <.src/common.hpp>
+#include <mutex>
+#include <vector>
+
+namespace jluna
+{
+    namespace detail
+    {
+        // names of ScopedFunctions that went out of scope. Julia never frees symbols, so names are reused
+        // rather than generated anew, which bounds the number of symbols by the number of functions alive at once
+        static inline std::vector<std::string> _scoped_function_names = {};
+        static inline std::mutex _scoped_function_names_lock;
+
+        /// @brief get name not used by any other ScopedFunction
+        inline std::string acquire_scoped_function_name()
+        {
+            std::lock_guard<std::mutex> guard(_scoped_function_names_lock);
+
+            if (_scoped_function_names.empty())
+                return "#parallel" + std::to_string(++_internal_function_id_name);
+
+            auto out = std::move(_scoped_function_names.back());
+            _scoped_function_names.pop_back();
+            return out;
+        }
+
+        /// @brief return name to the pool
+        inline void release_scoped_function_name(std::string&& name)
+        {
+            std::lock_guard<std::mutex> guard(_scoped_function_names_lock);
+            _scoped_function_names.push_back(std::move(name));
+        }
+
+        /// @brief register lambda under a unique name for the duration of the scope, julia-side it can be accessed through the returned function
+        template<typename Lambda_t>
+        class ScopedFunction
+        {
+            public:
+                ScopedFunction(const Lambda_t& lambda, bool gc_safe)
+                    : _name(acquire_scoped_function_name())
+                {
+                    try
+                    {
+                        register_function(_name, lambda, gc_safe);
+                    }
+                    catch (...)
+                    {
+                        release_scoped_function_name(std::move(_name));
+                        throw;
+                    }
+                }
+
+                ~ScopedFunction()
+                {
+                    c_adapter::unregister_function(_name);
+                    release_scoped_function_name(std::move(_name));
+                }
+
+                /// @brief julia-side function calling the lambda via cppcall
+                jl_value_t* get()
+                {
+                    jl_function_t* cppcall_wrapper = detail::cached([&]() -> jl_function_t* { return get_function("jluna.task_handler", "cppcall_wrapper"); });
+                    return jl_call1(cppcall_wrapper, (jl_value_t*) jl_symbol(_name.c_str()));
+                }
+
+            private:
+                std::string _name;
+        };
+    }
+
+    template<Boxable Return_t, Boxable Value_t, size_t Rank>
+    Array<Return_t, Rank> parallel_map(Proxy<State>& function, Array<Value_t, Rank>& array, size_t n_chunks)
+    {
+        THROW_IF_UNINITIALIZED;
+
+        jl_function_t* parallel_map = detail::cached([&]() -> jl_function_t* { return get_function("jluna.task_handler", "parallel_map"); });
+
+        // jl_call roots its arguments, so the gc may run while the chunks are processed
+        auto* result = safe_call(parallel_map, (jl_value_t*) function, (jl_value_t*) array, jl_box_uint64(n_chunks));
+
+        auto before = jl_gc_is_enabled();
+        jl_gc_enable(false);
+        auto out = Array<Return_t, Rank>(result);
+        jl_gc_enable(before);
+        return out;
+    }
+
+    template<Boxable Return_t, LambdaType<jl_value_t*> Lambda_t, Boxable Value_t, size_t Rank>
+        requires (not std::is_base_of_v<Proxy<State>, Lambda_t>)
+    Array<Return_t, Rank> parallel_map(const Lambda_t& lambda, Array<Value_t, Rank>& array, size_t n_chunks, bool gc_safe)
+    {
+        THROW_IF_UNINITIALIZED;
+
+        auto scoped = detail::ScopedFunction<Lambda_t>(lambda, gc_safe);
+        auto function = Proxy<State>(scoped.get(), nullptr);
+        return parallel_map<Return_t>(function, array, n_chunks);
+    }
+
+    template<Boxable Value_t, size_t Rank>
+    void parallel_for(Proxy<State>& function, Array<Value_t, Rank>& array, size_t n_chunks)
+    {
+        THROW_IF_UNINITIALIZED;
+
+        jl_function_t* parallel_for = detail::cached([&]() -> jl_function_t* { return get_function("jluna.task_handler", "parallel_for"); });
+        safe_call(parallel_for, (jl_value_t*) function, (jl_value_t*) array, jl_box_uint64(n_chunks));
+    }
+
+    template<LambdaType<jl_value_t*> Lambda_t, Boxable Value_t, size_t Rank>
+        requires (not std::is_base_of_v<Proxy<State>, Lambda_t>)
+    void parallel_for(const Lambda_t& lambda, Array<Value_t, Rank>& array, size_t n_chunks, bool gc_safe)
+    {
+        THROW_IF_UNINITIALIZED;
+
+        auto scoped = detail::ScopedFunction<Lambda_t>(lambda, gc_safe);
+        auto function = Proxy<State>(scoped.get(), nullptr);
+        parallel_for(function, array, n_chunks);
+    }
+}
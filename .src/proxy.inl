@@ -7,102 +7,127 @@
 #include <sstream>
 #include <deque>
 #include <sstream>
+#include <deadline.hpp>
 
 namespace jluna
 {
     template<typename State_t>
     Proxy<State_t>::ProxyValue::ProxyValue(jl_value_t* value, std::shared_ptr<ProxyValue>& owner, jl_sym_t* symbol)
-        : _is_mutating(symbol != nullptr)
+        : _segment{symbol == nullptr ? PathSegment::ROOT : PathSegment::FIELD, symbol, 0},
+          _is_mutating(symbol != nullptr)
     {
         if (value == nullptr)
             return;
 
         _owner = owner;
-        _value_key = State_t::create_reference(value);
-        _value_ref = State_t::get_reference(_value_key);
+        root(value);
+    }
 
-        if (symbol == nullptr)
-        {
-            std::stringstream str;
-            str << jl_id_marker << _value_key << "[]";
-            symbol = jl_symbol(str.str().c_str());
-        }
+    template<typename State_t>
+    Proxy<State_t>::ProxyValue::ProxyValue(jl_value_t* value, std::shared_ptr<ProxyValue>& owner, size_t index)
+        : _segment{PathSegment::INDEX, nullptr, index},
+          _is_mutating(true)
+    {
+        if (value == nullptr)
+            return;
 
-        _symbol_key = State_t::create_reference((jl_value_t*) symbol);
-        _symbol_ref = State_t::get_reference(_symbol_key);
+        _owner = owner;
+        root(value);
     }
 
     template<typename State_t>
     Proxy<State_t>::ProxyValue::ProxyValue(jl_value_t* value, jl_sym_t* symbol)
-        : _owner(nullptr), _is_mutating(symbol != nullptr)
+        : _owner(nullptr),
+          _segment{symbol == nullptr ? PathSegment::ROOT : PathSegment::FIELD, symbol, 0},
+          _is_mutating(symbol != nullptr)
     {
         if (value == nullptr)
             return;
 
-        _value_key = State_t::create_reference(value);
-        _value_ref = State_t::get_reference(_value_key);
-
-        if (symbol == nullptr)
-        {
-            std::stringstream str;
-            str << jl_id_marker << _value_key;
-            symbol = jl_symbol(str.str().c_str());
-        }
-
-        _symbol_key = State_t::create_reference((jl_value_t*) symbol);
-        _symbol_ref = State_t::get_reference(_symbol_key);
+        root(value);
     }
 
     template<typename State_t>
     Proxy<State_t>::ProxyValue::~ProxyValue()
     {
         State_t::free_reference(_value_key);
-        State_t::free_reference(_symbol_key);
     }
 
     template<typename State_t>
-    jl_value_t * Proxy<State_t>::ProxyValue::value()
+    void Proxy<State_t>::ProxyValue::root(jl_value_t* in, bool allow_frame)
     {
-        return jl_ref_value(_value_ref);
+        _is_immortal = jl_is_immortal(in);
+        _in_frame = not _is_immortal and allow_frame and State_t::frame_active();
+
+        if (_is_immortal)
+        {
+            _value_key = 0;
+            _value_ref = in;
+        }
+        else if (_in_frame)
+        {
+            _value_key = 0;
+            _value_ref = State_t::create_frame_reference(in);
+        }
+        else
+        {
+            _value_key = State_t::create_reference(in);
+            _value_ref = State_t::get_reference(_value_key);
+        }
     }
 
     template<typename State_t>
-    jl_value_t * Proxy<State_t>::ProxyValue::symbol()
+    void Proxy<State_t>::ProxyValue::set_value(jl_value_t* new_value)
     {
-        return jl_ref_value(_symbol_ref);
+        jl_function_t* safe_call = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return Main.jluna.exception_handler"), "safe_call"); });
+        jl_function_t* set_reference = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return Main.jluna.memory_handler"), "set_reference"); });
+        jl_function_t* setindex = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "setindex!"); });
+
+        if (_is_immortal)
+            root(new_value, false); // a frame opened after construction may not outlive this proxy
+        else if (_in_frame)
+            jl_call2(setindex, _value_ref, new_value);
+        else
+            _value_ref = jl_call3(safe_call, (jl_value_t*) set_reference, jl_box_uint64(_value_key), new_value);
+
+        forward_last_exception();
     }
 
     template<typename State_t>
-    size_t Proxy<State_t>::ProxyValue::value_key()
+    void Proxy<State_t>::ProxyValue::promote()
     {
-        return _value_key;
+        if (_in_frame)
+            root(value(), false);
+
+        if (_owner != nullptr)
+            _owner->promote();
     }
 
     template<typename State_t>
-    size_t Proxy<State_t>::ProxyValue::symbol_key()
+    jl_value_t * Proxy<State_t>::ProxyValue::value()
     {
-        return _symbol_key;
+        return _is_immortal ? _value_ref : jl_ref_value(_value_ref);
     }
 
     template<typename State_t>
-    const jl_value_t * Proxy<State_t>::ProxyValue::value() const
+    size_t Proxy<State_t>::ProxyValue::value_key()
     {
-        return jl_ref_value(_value_ref);
+        return _value_key;
     }
 
     template<typename State_t>
-    const jl_value_t * Proxy<State_t>::ProxyValue::symbol() const
+    const jl_value_t * Proxy<State_t>::ProxyValue::value() const
     {
-        return jl_ref_value(_symbol_ref);
+        return _is_immortal ? _value_ref : jl_ref_value(_value_ref);
     }
 
     template<typename State_t>
     jl_value_t * Proxy<State_t>::ProxyValue::get_field(jl_sym_t* symbol)
     {
-        static jl_module_t* jluna_module = (jl_module_t*) jl_eval_string("return Main.jluna");
-        static jl_module_t* exception_module = (jl_module_t*) jl_eval_string("return Main.jluna.exception_handler");
-        static jl_function_t* safe_call = jl_get_function(exception_module, "safe_call");
-        static jl_function_t* dot = jl_get_function(jluna_module, "dot");
+        jl_module_t* jluna_module = detail::cached([&]() -> jl_module_t* { return (jl_module_t*) jl_eval_string("return Main.jluna"); });
+        jl_module_t* exception_module = detail::cached([&]() -> jl_module_t* { return (jl_module_t*) jl_eval_string("return Main.jluna.exception_handler"); });
+        jl_function_t* safe_call = detail::cached([&]() -> jl_function_t* { return jl_get_function(exception_module, "safe_call"); });
+        jl_function_t* dot = detail::cached([&]() -> jl_function_t* { return jl_get_function(jluna_module, "dot"); });
 
         jl_value_t* args[3] = {(jl_value_t*) dot, value(), (jl_value_t*) symbol};
         auto* res = jl_call(safe_call, args, 3);
@@ -118,16 +143,26 @@ namespace jluna
         : _content(new ProxyValue(value, owner, symbol))
     {}
 
+    template<typename State_t>
+    Proxy<State_t>::Proxy(jl_value_t* value, std::shared_ptr<ProxyValue>& owner, size_t index)
+        : _content(new ProxyValue(value, owner, index))
+    {}
+
     template<typename State_t>
     Proxy<State_t>::Proxy(jl_value_t* value, jl_sym_t* symbol)
         : _content(new ProxyValue(value, symbol))
     {}
 
+    template<typename State_t>
+    Proxy<State_t>::Proxy(const std::shared_ptr<ProxyValue>& content)
+        : _content(content)
+    {}
+
     template<typename State_t>
     Proxy<State_t> Proxy<State_t>::operator[](const std::string& field)
     {
         jl_sym_t* symbol = jl_symbol(field.c_str());
-        return Proxy<State_t>(_content.get()->get_field(symbol), _content, _content->symbol() == nullptr ? nullptr : symbol);
+        return Proxy<State_t>(_content.get()->get_field(symbol), _content, symbol);
     }
 
     template<typename State_t>
@@ -141,19 +176,15 @@ namespace jluna
     template<typename State_t>
     auto Proxy<State_t>::operator[](size_t i)
     {
-        static jl_function_t* getindex = jl_get_function(jl_base_module, "getindex");
-        return Proxy<State_t>(
-                State_t::safe_call(getindex, _content->value(), i + 1),
-                _content,
-                jl_symbol(("[" + std::to_string(i + 1) + "]").c_str())
-        );
+        jl_function_t* getindex = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "getindex"); });
+        return Proxy<State_t>(State_t::safe_call(getindex, _content->value(), i + 1), _content, i);
     }
 
     template<typename State_t>
     template<Unboxable T>
     T Proxy<State_t>::operator[](size_t i)
     {
-        static jl_function_t* getindex = jl_get_function(jl_base_module, "getindex");
+        jl_function_t* getindex = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "getindex"); });
         return unbox<T>(State_t::safe_call(getindex, _content->value(), i + 1));
     }
 
@@ -166,7 +197,7 @@ namespace jluna
     template<typename State_t>
     Proxy<State_t>::operator std::string() const
     {
-        static jl_function_t* to_string = jl_get_function(jl_base_module, "string");
+        jl_function_t* to_string = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "string"); });
         return std::string(jl_string_data(jl_call1(to_string, _content->value())));
     }
 
@@ -181,7 +212,8 @@ namespace jluna
     template<typename T, std::enable_if_t<std::is_base_of_v<Proxy<State_t>, T>, bool>>
     Proxy<State_t>::operator T()
     {
-        return T(_content->value(), _content->_owner, (jl_sym_t*) _content->symbol());
+        // share content rather than binding the value anew, which would create another reference
+        return T(_content);
     }
 
     template<typename State_t>
@@ -192,40 +224,74 @@ namespace jluna
     }
 
     template<typename State_t>
-    std::deque<jl_sym_t*> Proxy<State_t>::assemble_name() const
+    std::deque<const typename Proxy<State_t>::ProxyValue*> Proxy<State_t>::collect_path() const
     {
+        std::deque<const ProxyValue*> segments;
         const ProxyValue* ptr = _content.get();
-        std::deque<jl_sym_t*> name;
 
-        while (ptr != nullptr and ptr->symbol() != nullptr)
+        while (ptr != nullptr)
         {
-            name.push_front((jl_sym_t*) ptr->symbol());
+            segments.push_front(ptr);
+
+            if (ptr->_segment.kind == PathSegment::ROOT)
+                break;
+
             ptr = ptr->_owner.get();
         }
 
-        return name;
+        return segments;
     }
 
     template<typename State_t>
-    std::string Proxy<State_t>::get_name() const
+    std::vector<jl_value_t*> Proxy<State_t>::assemble_path() const
     {
-        std::deque<jl_sym_t*> name = assemble_name();
-        std::stringstream str;
+        std::deque<const ProxyValue*> segments = collect_path();
 
-        for (size_t i = 0; i < name.size(); ++i)
+        std::vector<jl_value_t*> out;
+
+        // named values without an unnamed root are variables in Main
+        if (segments.front()->_segment.kind == PathSegment::ROOT)
         {
-            std::string sname = jl_symbol_name(name.at(i));
+            out.push_back((jl_value_t*) segments.front()->value());
+            segments.pop_front();
+        }
+        else
+            out.push_back((jl_value_t*) jl_main_module);
 
-            if (i != 0 and sname.at(0) != '[')
-                str << ".";
+        for (auto* segment : segments)
+        {
+            if (segment->_segment.kind == PathSegment::FIELD)
+                out.push_back((jl_value_t*) segment->_segment.field);
+            else
+                out.push_back(jl_box_int64(segment->_segment.index + 1));
+        }
+
+        return out;
+    }
 
-            if (sname.at(0) == jl_id_marker)
-                if (sname.at(1) == '1')
+    template<typename State_t>
+    std::string Proxy<State_t>::get_name() const
+    {
+        std::deque<const ProxyValue*> segments = collect_path();
+
+        std::stringstream str;
+
+        if (segments.front()->_segment.kind != PathSegment::ROOT)
+            str << "Main";
+
+        for (auto* segment : segments)
+        {
+            if (segment->_segment.kind == PathSegment::ROOT)
+            {
+                if (segment->value() == (jl_value_t*) jl_main_module)
                     str << "Main";
                 else
-                    str << "<unnamed proxy " << jl_symbol_name(name.at(i)) << ">";
+                    str << "<unnamed proxy #" << segment->_value_key << ">";
+            }
+            else if (segment->_segment.kind == PathSegment::FIELD)
+                str << "." << jl_symbol_name(segment->_segment.field);
             else
-                str << jl_symbol_name(name.at(i));
+                str << "[" << segment->_segment.index + 1 << "]";
         }
 
         return str.str();
@@ -252,8 +318,8 @@ namespace jluna
     template<Boxable... Args_t>
     auto Proxy<State_t>::call(Args_t&&... args)
     {
-        static jl_module_t* jluna_module = (jl_module_t*) jl_eval_string("return jluna");
-        static jl_function_t* invoke = jl_get_function(jluna_module, "invoke");
+        jl_module_t* jluna_module = detail::cached([&]() -> jl_module_t* { return (jl_module_t*) jl_eval_string("return jluna"); });
+        jl_function_t* invoke = detail::cached([&]() -> jl_function_t* { return jl_get_function(jluna_module, "invoke"); });
 
         return Proxy<State>(State_t::call(invoke, _content->value(), std::forward<Args_t>(args)...), nullptr);
     }
@@ -262,12 +328,48 @@ namespace jluna
     template<Boxable... Args_t>
     auto Proxy<State_t>::safe_call(Args_t&&... args)
     {
-        static jl_module_t* jluna_module = (jl_module_t*) jl_eval_string("return jluna");
-        static jl_function_t* invoke = jl_get_function(jluna_module, "invoke");
+        jl_module_t* jluna_module = detail::cached([&]() -> jl_module_t* { return (jl_module_t*) jl_eval_string("return jluna"); });
+        jl_function_t* invoke = detail::cached([&]() -> jl_function_t* { return jl_get_function(jluna_module, "invoke"); });
 
         return Proxy<State>(safe_call(invoke, _content->value(), std::forward<Args_t>(args)...), nullptr);
     }
 
+    template<typename State_t>
+    template<typename Rep_t, typename Period_t, Boxable... Args_t>
+    auto Proxy<State_t>::safe_call_for(std::chrono::duration<Rep_t, Period_t> timeout, Args_t&&... args)
+    {
+        jl_module_t* jluna_module = detail::cached([&]() -> jl_module_t* { return (jl_module_t*) jl_eval_string("return jluna"); });
+        jl_function_t* invoke = detail::cached([&]() -> jl_function_t* { return jl_get_function(jluna_module, "invoke"); });
+        jl_function_t* safe_call = detail::cached([&]() -> jl_function_t* { return get_function("Main.jluna.exception_handler", "safe_call"); });
+
+        detail::Deadline deadline(std::chrono::duration_cast<std::chrono::nanoseconds>(timeout));
+        auto* result = State_t::call(safe_call, (jl_value_t*) invoke, _content->value(), std::forward<Args_t>(args)...);
+        deadline.disarm();
+
+        forward_last_exception();
+        return Proxy<State>(result, nullptr);
+    }
+
+    template<typename State_t>
+    template<typename Return_t, Boxable... Args_t>
+    std::future<Return_t> Proxy<State_t>::call_async(Args_t&&... args)
+    {
+        jl_module_t* jluna_module = detail::cached([&]() -> jl_module_t* { return (jl_module_t*) jl_eval_string("return jluna"); });
+        jl_function_t* invoke = detail::cached([&]() -> jl_function_t* { return jl_get_function(jluna_module, "invoke"); });
+
+        return State_t::template async_call<Return_t>(invoke, true, _content->value(), std::forward<Args_t>(args)...);
+    }
+
+    template<typename State_t>
+    template<typename Return_t, Boxable... Args_t>
+    Awaitable<Return_t> Proxy<State_t>::call_awaitable(Args_t&&... args)
+    {
+        jl_module_t* jluna_module = detail::cached([&]() -> jl_module_t* { return (jl_module_t*) jl_eval_string("return jluna"); });
+        jl_function_t* invoke = detail::cached([&]() -> jl_function_t* { return jl_get_function(jluna_module, "invoke"); });
+
+        return Awaitable<Return_t>(invoke, true, _content->value(), std::forward<Args_t>(args)...);
+    }
+
     template<typename State_t>
     template<Boxable... Args_t>
     auto Proxy<State_t>::operator()(Args_t&&... args)
@@ -284,23 +386,17 @@ namespace jluna
     template<typename State_t>
     auto & Proxy<State_t>::operator=(jl_value_t* new_value)
     {
-        static jl_function_t* safe_call = jl_get_function((jl_module_t*) jl_eval_string("return Main.jluna.exception_handler"), "safe_call");
-        static jl_function_t* set_reference = jl_get_function((jl_module_t*) jl_eval_string("return Main.jluna.memory_handler"), "set_reference");
-
         auto before = jl_gc_is_enabled();
         jl_gc_enable(false);
 
-        _content->_value_ref = jl_call3(safe_call, (jl_value_t*) set_reference,
-                                        jl_box_uint64(_content->value_key()), new_value);
-        forward_last_exception();
+        _content->set_value(new_value);
 
         if (_content->_is_mutating)
         {
-            static jl_function_t* assign = get_function("Main.jluna.memory_handler", "assign");
-            auto name_q = assemble_name();
+            jl_function_t* assign = detail::cached([&]() -> jl_function_t* { return get_function("Main.jluna.memory_handler", "assign"); });
             std::vector<jl_value_t*> params = {assign, new_value};
-            for (auto* s : name_q)
-                params.push_back((jl_value_t*) s);
+            for (auto* s : assemble_path())
+                params.push_back(s);
 
             safe_call_params(params);
         }
@@ -325,20 +421,27 @@ namespace jluna
     template<typename State_t>
     void Proxy<State_t>::update()
     {
-        static jl_function_t* safe_call = jl_get_function((jl_module_t*) jl_eval_string("return Main.jluna.exception_handler"), "safe_call");
-        static jl_function_t* assemble_eval = jl_get_function((jl_module_t*) jl_eval_string("return Main.jluna.memory_handler"), "evaluate");
-        static jl_function_t* set_reference = jl_get_function((jl_module_t*) jl_eval_string("return Main.jluna.memory_handler"), "set_reference");
+        jl_function_t* safe_call = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return Main.jluna.exception_handler"), "safe_call"); });
+        jl_function_t* assemble_eval = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return Main.jluna.memory_handler"), "evaluate"); });
+
+        auto before = jl_gc_is_enabled();
+        jl_gc_enable(false);
 
-        auto name = assemble_name();
         std::vector<jl_value_t*> args = {(jl_value_t*) assemble_eval};
 
-        for (auto* n : name)
-            args.push_back((jl_value_t*) n);
+        for (auto* n : assemble_path())
+            args.push_back(n);
 
         jl_value_t* new_value = jl_call(safe_call, args.data(), args.size());
         forward_last_exception();
 
-        _content->_value_ref = jl_call3(safe_call, (jl_value_t*) set_reference, jl_box_uint64(_content->value_key()), new_value);
-        forward_last_exception();
+        _content->set_value(new_value);
+        jl_gc_enable(before);
+    }
+
+    template<typename State_t>
+    void Proxy<State_t>::promote()
+    {
+        _content->promote();
     }
 }
\ No newline at end of file
@@ -0,0 +1,154 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 03.03.22 by clem (mail@clemens-cords.com)
+//
+
+#include <sstream>
+#include <stdexcept>
+
+#include <.src/common.hpp>
+
+namespace jluna
+{
+    template<IsJuliaBits V>
+    Range<V>::Range(jl_value_t* value, std::shared_ptr<typename Proxy<State>::ProxyValue>& owner, jl_sym_t* symbol)
+        : Proxy<State>(value, owner, symbol)
+    {
+        read_layout();
+    }
+
+    template<IsJuliaBits V>
+    Range<V>::Range(jl_value_t* value, jl_sym_t* symbol)
+        : Proxy<State>(value, symbol)
+    {
+        read_layout();
+    }
+
+    template<IsJuliaBits V>
+    Range<V>::Range(const std::shared_ptr<typename Proxy<State>::ProxyValue>& content)
+        : Proxy<State>(content)
+    {
+        read_layout();
+    }
+
+    template<IsJuliaBits V>
+    void Range<V>::read_layout()
+    {
+        THROW_IF_UNINITIALIZED;
+
+        jl_function_t* range_layout = detail::cached([&]() -> jl_function_t* { return get_function("jluna.view_handler", "range_layout"); });
+
+        auto before = jl_gc_is_enabled();
+        jl_gc_enable(false);
+
+        jl_value_t* layout;
+        try
+        {
+            layout = safe_call(range_layout, _content->value(), (jl_value_t*) to_julia_type<V>());
+        }
+        catch (...)
+        {
+            jl_gc_enable(before);
+            throw;
+        }
+
+        _first = unbox<V>(jl_get_nth_field(layout, 0));
+        _step = unbox<V>(jl_get_nth_field(layout, 1));
+        _size = jl_unbox_uint64(jl_get_nth_field(layout, 2));
+
+        jl_gc_enable(before);
+    }
+
+    template<IsJuliaBits V>
+    V Range<V>::operator[](size_t i) const
+    {
+        return static_cast<V>(_first + static_cast<V>(i) * _step);
+    }
+
+    template<IsJuliaBits V>
+    V Range<V>::at(size_t i) const
+    {
+        if (i >= _size)
+        {
+            std::stringstream str;
+            str << "0-based index " << i << " out of range for range of length " << _size << std::endl;
+            throw std::out_of_range(str.str().c_str());
+        }
+
+        return operator[](i);
+    }
+
+    template<IsJuliaBits V>
+    V Range<V>::first() const
+    {
+        return _first;
+    }
+
+    template<IsJuliaBits V>
+    V Range<V>::step() const
+    {
+        return _step;
+    }
+
+    template<IsJuliaBits V>
+    V Range<V>::last() const
+    {
+        return at(_size - 1);
+    }
+
+    template<IsJuliaBits V>
+    size_t Range<V>::size() const
+    {
+        return _size;
+    }
+
+    template<IsJuliaBits V>
+    bool Range<V>::empty() const
+    {
+        return _size == 0;
+    }
+
+    template<IsJuliaBits V>
+    typename Range<V>::Iterator Range<V>::begin() const
+    {
+        return Iterator(0, this);
+    }
+
+    template<IsJuliaBits V>
+    typename Range<V>::Iterator Range<V>::end() const
+    {
+        return Iterator(_size, this);
+    }
+
+    template<IsJuliaBits V>
+    Range<V>::Iterator::Iterator(size_t i, const Range<V>* owner)
+        : _index(i), _owner(owner)
+    {}
+
+    template<IsJuliaBits V>
+    V Range<V>::Iterator::operator*() const
+    {
+        return _owner->operator[](_index);
+    }
+
+    template<IsJuliaBits V>
+    typename Range<V>::Iterator& Range<V>::Iterator::operator++()
+    {
+        _index += 1;
+        return *this;
+    }
+
+    template<IsJuliaBits V>
+    typename Range<V>::Iterator Range<V>::Iterator::operator++(int)
+    {
+        auto out = *this;
+        _index += 1;
+        return out;
+    }
+
+    template<IsJuliaBits V>
+    bool Range<V>::Iterator::operator==(const Iterator& other) const
+    {
+        return _index == other._index and _owner == other._owner;
+    }
+}
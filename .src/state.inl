@@ -6,7 +6,10 @@
 #include <julia.h>
 #include <state.hpp>
 #include <sstream>
+#include <stdexcept>
+#include <cstring>
 #include <exceptions.hpp>
+#include <deadline.hpp>
 #include <box_any.hpp>
 #include <symbol_proxy.hpp>
 #include <global_utilities.hpp>
@@ -19,6 +22,11 @@ namespace jluna
     {
         static void on_exit()
         {
+            // may be called both by an executor and at exit
+            static std::atomic<bool> done = false;
+            if (done.exchange(true))
+                return;
+
             jl_eval_string(R"([JULIA][LOG] Shutting down...)");
             jl_eval_string("jluna.memory_handler.force_free()");
             jl_atexit_hook(0);
@@ -54,8 +62,10 @@ namespace jluna
         jl_module_t* module = (jl_module_t*) jl_eval_string("return jluna.memory_handler");
         _create_reference = jl_get_function(module, "create_reference");
         _free_reference =  jl_get_function(module, "free_reference");
+        _free_references =  jl_get_function(module, "free_references");
         _force_free =  jl_get_function(module, "force_free");
         _get_reference =  jl_get_function(module, "get_reference");
+        _add_to_frame = jl_get_function(module, "add_to_frame");
 
         jluna::Main = Proxy<State>((jl_value_t*) jl_main_module, nullptr);
         jluna::Base = Main["Base"];
@@ -110,6 +120,26 @@ namespace jluna
         return Proxy<State>(result, nullptr);
     }
 
+    template<typename Rep_t, typename Period_t>
+    auto State::safe_script_for(const std::string& command, std::chrono::duration<Rep_t, Period_t> timeout)
+    {
+        THROW_IF_UNINITIALIZED;
+
+        std::stringstream str;
+        str << "jluna.exception_handler.safe_call(quote " << command << " end)" << std::endl;
+
+        detail::Deadline deadline(std::chrono::duration_cast<std::chrono::nanoseconds>(timeout));
+        auto* result = jl_eval_string(str.str().c_str());
+        bool expired = deadline.disarm();
+
+        if (expired or jl_exception_occurred() or exception_occurred())
+        {
+            std::cerr << "exception in jluna::State::safe_script_for for expression:\n\"" << command << "\"\n" << std::endl;
+            forward_last_exception();
+        }
+        return Proxy<State>(result, nullptr);
+    }
+
     template<typename T>
     T State::safe_return(const std::string& full_name)
     {
@@ -145,7 +175,7 @@ namespace jluna
     {
         THROW_IF_UNINITIALIZED;
 
-        static jl_function_t* tostring = jl_get_function(jl_base_module, "string");
+        jl_function_t* tostring = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "string"); });
         std::array<jl_value_t*, sizeof...(Args_t) + 1> params;
         auto insert = [&](size_t i, jl_value_t* to_insert) {params.at(i) = to_insert;};
 
@@ -155,8 +185,8 @@ namespace jluna
             (insert(i++, box(std::forward<Args_t>(args))), ...);
         }
 
-        static jl_module_t* module = (jl_module_t*) jl_eval_string("return jluna.exception_handler");
-        static jl_function_t* safe_call = jl_get_function(module, "safe_call");
+        jl_module_t* module = detail::cached([&]() -> jl_module_t* { return (jl_module_t*) jl_eval_string("return jluna.exception_handler"); });
+        jl_function_t* safe_call = detail::cached([&]() -> jl_function_t* { return jl_get_function(module, "safe_call"); });
         auto* result = jl_call(safe_call, params.data(), params.size());
 
         forward_last_exception();
@@ -177,19 +207,92 @@ namespace jluna
             (insert(i++, (jl_value_t*) args), ...);
         }
 
-        static jl_module_t* module = (jl_module_t*) jl_eval_string("return jluna.exception_handler");
-        static jl_function_t* safe_call = jl_get_function(module, "safe_call");
+        jl_module_t* module = detail::cached([&]() -> jl_module_t* { return (jl_module_t*) jl_eval_string("return jluna.exception_handler"); });
+        jl_function_t* safe_call = detail::cached([&]() -> jl_function_t* { return jl_get_function(module, "safe_call"); });
         auto* result = jl_call(safe_call, params.data(), params.size());
         forward_last_exception();
 
         return result;
     }
 
+    template<typename Return_t>
+    Return_t State::unpack_task_result(jl_value_t* tuple)
+    {
+        auto* exception = jl_get_nth_field(tuple, 1);
+        if (exception != jl_nothing)
+            throw JuliaException(exception, std::string(jl_string_data(jl_get_nth_field(tuple, 2))));
+
+        if constexpr (std::is_same_v<Return_t, void>)
+            return;
+        else if constexpr (std::is_same_v<Return_t, Proxy<State>>)
+            return Proxy<State>(jl_get_nth_field(tuple, 0), nullptr);
+        else
+            return unbox<Return_t>(jl_get_nth_field(tuple, 0));
+    }
+
+    template<typename... Args_t>
+    void State::schedule_call(std::function<void(jl_value_t*)>&& callback, jl_function_t* function, bool spawn, Args_t&&... args)
+    {
+        THROW_IF_UNINITIALIZED;
+
+        jl_function_t* schedule_call = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return jluna.task_handler"), "schedule_call"); });
+
+        size_t id = c_adapter::register_callback(std::move(callback));
+
+        auto before = jl_gc_is_enabled();
+        jl_gc_enable(false);
+
+        try
+        {
+            safe_call(schedule_call, jl_box_uint64(id), jl_box_bool(spawn), (jl_value_t*) function, box(std::forward<Args_t>(args))...);
+        }
+        catch (...)
+        {
+            jl_gc_enable(before);
+            c_adapter::unregister_callback(id);
+            throw;
+        }
+
+        jl_gc_enable(before);
+    }
+
+    template<typename Return_t, typename... Args_t>
+    std::future<Return_t> State::async_call(jl_function_t* function, bool spawn, Args_t&&... args)
+    {
+        THROW_IF_UNINITIALIZED;
+
+        auto promise = std::make_shared<std::promise<Return_t>>();
+        auto future = promise->get_future();
+
+        // invoked by whichever julia thread ran the task
+        schedule_call([promise](jl_value_t* tuple) {
+
+            try
+            {
+                if constexpr (std::is_same_v<Return_t, void>)
+                {
+                    unpack_task_result<void>(tuple);
+                    promise->set_value();
+                }
+                else
+                    promise->set_value(unpack_task_result<Return_t>(tuple));
+            }
+            catch (...)
+            {
+                promise->set_exception(std::current_exception());
+            }
+        }, function, spawn, std::forward<Args_t>(args)...);
+
+        return future;
+    }
+
     void State::collect_garbage()
     {
         THROW_IF_UNINITIALIZED;
 
-        static jl_function_t* gc = jl_get_function((jl_module_t*) jl_eval_string("return Base.GC"), "gc");
+        jl_function_t* gc = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return Base.GC"), "gc"); });
+
+        flush_references();
 
         bool before = jl_gc_is_enabled();
 
@@ -205,11 +308,18 @@ namespace jluna
         jl_gc_enable(b);
     }
 
+    void State::set_exit_on_sigint(bool b)
+    {
+        THROW_IF_UNINITIALIZED;
+
+        detail::Deadline::set_exit_on_sigint(b);
+    }
+
     size_t State::create_reference(jl_value_t* in)
     {
         THROW_IF_UNINITIALIZED;
 
-        static jl_value_t* _refs = jl_eval_string("return jluna.memory_handler._refs[]");
+        jl_value_t* _refs = detail::cached([&]() -> jl_value_t* { return jl_eval_string("return jluna.memory_handler._refs[]"); });
 
         if (in == nullptr)// or in == _refs)
             return 0;
@@ -238,10 +348,119 @@ namespace jluna
         if (key == 0)
             return;
 
+        bool flush;
+        {
+            std::lock_guard<std::mutex> guard(_free_queue_lock);
+            _free_queue.push_back(key);
+            flush = _free_queue.size() >= _free_queue_threshold;
+        }
+
+        if (flush)
+            flush_references();
+    }
+
+    void State::flush_references()
+    {
+        THROW_IF_UNINITIALIZED;
+
+        // take the queue under the lock, julia is only called after it was released
+        std::vector<size_t> queue;
+        {
+            std::lock_guard<std::mutex> guard(_free_queue_lock);
+            queue.swap(_free_queue);
+        }
+
+        if (queue.empty())
+            return;
+
+        jl_value_t* vector_type = detail::cached([&]() -> jl_value_t* { return jl_apply_array_type((jl_value_t*) jl_uint64_type, 1); });
+
+        auto before = jl_gc_is_enabled();
+        jl_gc_enable(false);
+
+        jl_array_t* keys = jl_alloc_array_1d(vector_type, queue.size());
+        std::memcpy(jl_array_data(keys), queue.data(), queue.size() * sizeof(size_t));
+
+        safe_call(_free_references, (jl_value_t*) keys);
+        jl_gc_enable(before);
+    }
+
+    void State::adopt_thread()
+    {
+        THROW_IF_UNINITIALIZED;
+
+        #if JULIA_VERSION_MAJOR > 1 or JULIA_VERSION_MINOR >= 9
+            if (jl_get_pgcstack() == nullptr)
+                jl_adopt_thread();
+        #else
+            throw std::runtime_error("In State::adopt_thread: calling julia from a thread it did not create requires julia 1.9 or newer");
+        #endif
+    }
+
+    size_t State::poll(size_t budget)
+    {
+        THROW_IF_UNINITIALIZED;
+
+        jl_function_t* poll = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return jluna.task_handler"), "poll"); });
+        return jl_unbox_uint64(safe_call(poll, jl_box_uint64(budget)));
+    }
+
+    template<typename Rep_t, typename Period_t>
+    void State::run_for(std::chrono::duration<Rep_t, Period_t> duration)
+    {
+        THROW_IF_UNINITIALIZED;
+
+        jl_function_t* run_for = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return jluna.task_handler"), "run_for"); });
+
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        if (ns <= 0)
+            return;
+
+        safe_call(run_for, jl_box_uint64(ns));
+    }
+
+    void State::push_frame()
+    {
+        THROW_IF_UNINITIALIZED;
+
+        jl_value_t* frame = (jl_value_t*) jl_alloc_vec_any(0);
+        _frames.emplace_back(create_reference(frame), frame);
+    }
+
+    void State::pop_frame() noexcept
+    {
+        THROW_IF_UNINITIALIZED;
+        assert(not _frames.empty() && "In State::pop_frame: no frame is currently open");
+
+        size_t key = _frames.back().first;
+        _frames.pop_back();
+
         auto before = jl_gc_is_enabled();
         jl_gc_enable(false);
-        safe_call(_free_reference, jl_box_uint64(reinterpret_cast<size_t>(key)));
+        jl_call1(_free_reference, jl_box_uint64(key));
         jl_gc_enable(before);
+
+        // called from Frame::~Frame, so report instead of throwing
+        if (jl_exception_occurred())
+        {
+            std::cerr << "In State::pop_frame: failed to release frame: " << jl_typeof_str(jl_exception_occurred()) << std::endl;
+            jl_exception_clear();
+        }
+    }
+
+    bool State::frame_active()
+    {
+        return not _frames.empty();
+    }
+
+    jl_value_t* State::create_frame_reference(jl_value_t* in)
+    {
+        THROW_IF_UNINITIALIZED;
+        assert(not _frames.empty() && "In State::create_frame_reference: no frame is currently open");
+
+        auto* out = jl_call2(_add_to_frame, _frames.back().second, in);
+        forward_last_exception();
+        return out;
     }
 
     jl_function_t* State::find_function(const std::string& function_name)
@@ -249,7 +468,7 @@ namespace jluna
         /*
         THROW_IF_UNINITIALIZED;
 
-        static jl_function_t* get_function = jl_get_function(_jluna_module, "find_function");
+        jl_function_t* get_function = detail::cached([&]() -> jl_function_t* { return jl_get_function(_jluna_module, "find_function"); });
         jl_array_t* res = (jl_array_t*) (jl_value_t*) safe_call(get_function, (jl_value_t*) jl_symbol(&function_name[0]));
 
         if (res->length == 0)
@@ -260,10 +479,10 @@ namespace jluna
         else if (not res->length == 1)
         {
             std::vector<std::string> candidate_modules;
-            static jl_function_t* get_all_modules_defining = jl_get_function(_jluna_module, "get_all_modules_defining");
+            jl_function_t* get_all_modules_defining = detail::cached([&]() -> jl_function_t* { return jl_get_function(_jluna_module, "get_all_modules_defining"); });
             auto* candidate_array = (jl_array_t*) safe_call(get_all_modules_defining, (jl_value_t*) script("return Symbol(\"" + function_name + "\")"));
 
-            static jl_function_t* to_string = jl_get_function(jl_base_module, "string");
+            jl_function_t* to_string = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "string"); });
 
             for (size_t i = 0; i < candidate_array->length; ++i)
             {
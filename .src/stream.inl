@@ -0,0 +1,133 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 01.03.22 by clem (mail@clemens-cords.com)
+//
+
+#include <cstring>
+
+#include <.src/common.hpp>
+
+namespace jluna
+{
+    namespace detail
+    {
+        jl_value_t* new_stream(jl_value_t* iterable)
+        {
+            jl_function_t* new_stream = detail::cached([&]() -> jl_function_t* { return get_function("jluna.iterator_handler", "new_stream"); });
+            return safe_call(new_stream, iterable);
+        }
+    }
+
+    template<typename V>
+    Stream<V>::Stream(Proxy<State>& iterable, size_t batch_size)
+        : _stream(detail::new_stream((jl_value_t*) iterable), nullptr), _batch_size(batch_size)
+    {
+        assert(batch_size > 0);
+    }
+
+    template<typename V>
+    void Stream<V>::pull()
+    {
+        jl_function_t* next_batch = detail::cached([&]() -> jl_function_t* { return get_function("jluna.iterator_handler", "next_batch"); });
+
+        jl_value_t* type;
+        if constexpr (IsJuliaBits<V>)
+            type = (jl_value_t*) to_julia_type<V>();
+        else
+            type = (jl_value_t*) jl_any_type;
+
+        auto before = jl_gc_is_enabled();
+        jl_gc_enable(false);
+
+        jl_array_t* batch;
+        try
+        {
+            batch = (jl_array_t*) safe_call(next_batch, (jl_value_t*) _stream, type, jl_box_uint64(_batch_size));
+        }
+        catch (...)
+        {
+            jl_gc_enable(before);
+            throw;
+        }
+
+        size_t n = jl_array_len(batch);
+        _batch.clear();
+
+        if constexpr (IsJuliaBits<V> and not std::is_same_v<V, Bool>)
+        {
+            _batch.resize(n);
+            std::memcpy(_batch.data(), jl_array_data(batch), n * sizeof(V));
+        }
+        else if constexpr (std::is_same_v<V, Bool>)
+        {
+            _batch.reserve(n);
+            for (size_t i = 0; i < n; ++i)
+                _batch.push_back(reinterpret_cast<uint8_t*>(jl_array_data(batch))[i] != 0);
+        }
+        else
+        {
+            _batch.reserve(n);
+            for (size_t i = 0; i < n; ++i)
+            {
+                if constexpr (std::is_same_v<V, Proxy<State>>)
+                    _batch.emplace_back(jl_arrayref(batch, i), nullptr);
+                else
+                    _batch.push_back(unbox<V>(jl_arrayref(batch, i)));
+            }
+        }
+
+        jl_gc_enable(before);
+
+        _index = 0;
+        _done = n < _batch_size;
+    }
+
+    template<typename V>
+    typename Stream<V>::Iterator Stream<V>::begin()
+    {
+        if (_index >= _batch.size() and not _done)
+            pull();
+
+        return Iterator(this);
+    }
+
+    template<typename V>
+    std::default_sentinel_t Stream<V>::end() const
+    {
+        return std::default_sentinel;
+    }
+
+    template<typename V>
+    Stream<V>::Iterator::Iterator(Stream<V>* owner)
+        : _owner(owner)
+    {}
+
+    template<typename V>
+    V& Stream<V>::Iterator::operator*() const
+    {
+        return _owner->_batch.at(_owner->_index);
+    }
+
+    template<typename V>
+    typename Stream<V>::Iterator& Stream<V>::Iterator::operator++()
+    {
+        _owner->_index += 1;
+
+        if (_owner->_index >= _owner->_batch.size() and not _owner->_done)
+            _owner->pull();
+
+        return *this;
+    }
+
+    template<typename V>
+    void Stream<V>::Iterator::operator++(int)
+    {
+        operator++();
+    }
+
+    template<typename V>
+    bool Stream<V>::Iterator::operator==(std::default_sentinel_t) const
+    {
+        return _owner->_index >= _owner->_batch.size();
+    }
+}
@@ -0,0 +1,149 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 03.03.22 by clem (mail@clemens-cords.com)
+//
+
+#include <stdexcept>
+
+#include <.src/common.hpp>
+
+namespace jluna
+{
+    template<IsJuliaBits V, size_t R>
+    StridedView<V, R>::StridedView(jl_value_t* value, std::shared_ptr<typename Proxy<State>::ProxyValue>& owner, jl_sym_t* symbol)
+        : Proxy<State>(value, owner, symbol)
+    {
+        read_layout();
+    }
+
+    template<IsJuliaBits V, size_t R>
+    StridedView<V, R>::StridedView(jl_value_t* value, jl_sym_t* symbol)
+        : Proxy<State>(value, symbol)
+    {
+        read_layout();
+    }
+
+    template<IsJuliaBits V, size_t R>
+    StridedView<V, R>::StridedView(const std::shared_ptr<typename Proxy<State>::ProxyValue>& content)
+        : Proxy<State>(content)
+    {
+        read_layout();
+    }
+
+    template<IsJuliaBits V, size_t R>
+    void StridedView<V, R>::read_layout()
+    {
+        THROW_IF_UNINITIALIZED;
+
+        jl_function_t* strided_layout = detail::cached([&]() -> jl_function_t* { return get_function("jluna.view_handler", "strided_layout"); });
+
+        auto before = jl_gc_is_enabled();
+        jl_gc_enable(false);
+
+        jl_value_t* layout;
+        try
+        {
+            layout = safe_call(strided_layout, _content->value(), (jl_value_t*) to_julia_type<V>(), jl_box_int64(R));
+        }
+        catch (...)
+        {
+            jl_gc_enable(before);
+            throw;
+        }
+
+        _data = reinterpret_cast<V*>(jl_unbox_uint64(jl_get_nth_field(layout, 0)));
+
+        jl_value_t* extents = jl_get_nth_field(layout, 1);
+        jl_value_t* strides = jl_get_nth_field(layout, 2);
+
+        for (size_t i = 0; i < R; ++i)
+        {
+            _extents[i] = jl_unbox_uint64(jl_get_nth_field(extents, i));
+            _strides[i] = jl_unbox_int64(jl_get_nth_field(strides, i));
+        }
+
+        jl_gc_enable(before);
+    }
+
+    template<IsJuliaBits V, size_t R>
+    template<std::integral... Args>
+        requires (sizeof...(Args) == R)
+    V& StridedView<V, R>::operator()(Args... indices) const
+    {
+        std::array<std::ptrdiff_t, R> index = {static_cast<std::ptrdiff_t>(indices)...};
+
+        std::ptrdiff_t offset = 0;
+        for (size_t i = 0; i < R; ++i)
+            offset += index[i] * _strides[i];
+
+        return _data[offset];
+    }
+
+    template<IsJuliaBits V, size_t R>
+    V& StridedView<V, R>::operator[](size_t linear) const
+    {
+        std::ptrdiff_t offset = 0;
+        for (size_t i = 0; i < R; ++i)
+        {
+            offset += static_cast<std::ptrdiff_t>(linear % _extents[i]) * _strides[i];
+            linear /= _extents[i];
+        }
+
+        return _data[offset];
+    }
+
+    template<IsJuliaBits V, size_t R>
+    size_t StridedView<V, R>::extent(size_t dimension) const
+    {
+        return _extents.at(dimension);
+    }
+
+    template<IsJuliaBits V, size_t R>
+    std::ptrdiff_t StridedView<V, R>::stride(size_t dimension) const
+    {
+        return _strides.at(dimension);
+    }
+
+    template<IsJuliaBits V, size_t R>
+    size_t StridedView<V, R>::size() const
+    {
+        size_t out = 1;
+        for (auto extent : _extents)
+            out *= extent;
+
+        return out;
+    }
+
+    template<IsJuliaBits V, size_t R>
+    V* StridedView<V, R>::data() const
+    {
+        return _data;
+    }
+
+    template<IsJuliaBits V, size_t R>
+    bool StridedView<V, R>::is_contiguous() const
+    {
+        std::ptrdiff_t expected = 1;
+        for (size_t i = 0; i < R; ++i)
+        {
+            if (_extents[i] > 1 and _strides[i] != expected)
+                return false;
+
+            expected *= _extents[i];
+        }
+
+        return true;
+    }
+
+    template<IsJuliaBits V, size_t R>
+    MatrixView<V> StridedView<V, R>::as_matrix() const requires (R == 2)
+    {
+        bool columns_contiguous = _strides[0] == 1 or _extents[0] <= 1;
+        bool columns_ordered = _extents[1] <= 1 or _strides[1] >= static_cast<std::ptrdiff_t>(_extents[0]);
+
+        if (not columns_contiguous or not columns_ordered)
+            throw std::invalid_argument("strided array cannot be viewed as a matrix, its columns are not contiguous");
+
+        return MatrixView<V>(_data, _extents[0], _extents[1], _extents[1] > 1 ? _strides[1] : _extents[0]);
+    }
+}
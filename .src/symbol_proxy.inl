@@ -38,6 +38,13 @@ namespace jluna
         assert(jl_isa(value, (jl_value_t*) jl_symbol_type) && "value being bound is not a symbol");
     }
 
+    Symbol::Symbol(const std::shared_ptr<typename Proxy<State>::ProxyValue>& content)
+        : Proxy<State>(content)
+    {
+        THROW_IF_UNINITIALIZED;
+        assert(jl_isa(content->value(), (jl_value_t*) jl_symbol_type) && "value being bound is not a symbol");
+    }
+
     Symbol::operator std::string() const
     {
         return std::string(jl_symbol_name((jl_sym_t*) _content->value()));
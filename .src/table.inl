@@ -0,0 +1,141 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 02.03.22 by clem (mail@clemens-cords.com)
+//
+
+#include <cstring>
+#include <utility>
+
+#include <.src/common.hpp>
+
+namespace jluna
+{
+    namespace detail
+    {
+        /// @brief julia-side element type of a column
+        template<typename T>
+        jl_value_t* column_type()
+        {
+            if constexpr (IsJuliaBits<T>)
+                return (jl_value_t*) to_julia_type<T>();
+            else
+                return (jl_value_t*) jl_any_type;
+        }
+
+        /// @brief box column into Vector, unrooted
+        template<Boxable T>
+        jl_value_t* box_column(std::span<const T> data)
+        {
+            auto* out = jl_alloc_array_1d(jl_apply_array_type(column_type<T>(), 1), data.size());
+
+            if constexpr (IsJuliaBits<T>)
+            {
+                if (not data.empty())
+                    std::memcpy(jl_array_data(out), data.data(), data.size() * sizeof(T));
+            }
+            else
+            {
+                for (size_t i = 0; i < data.size(); ++i)
+                    jl_arrayset(out, box(data[i]), i);
+            }
+
+            return (jl_value_t*) out;
+        }
+
+        /// @brief unbox Vector into column
+        template<Unboxable T>
+        std::vector<T> unbox_column(jl_value_t* column)
+        {
+            auto* array = (jl_array_t*) column;
+            size_t n = jl_array_len(array);
+
+            std::vector<T> out;
+
+            if constexpr (IsJuliaBits<T> and not std::is_same_v<T, Bool>)
+            {
+                out.resize(n);
+                if (n > 0)
+                    std::memcpy(out.data(), jl_array_data(array), n * sizeof(T));
+            }
+            else if constexpr (std::is_same_v<T, Bool>)
+            {
+                out.reserve(n);
+                for (size_t i = 0; i < n; ++i)
+                    out.push_back(reinterpret_cast<uint8_t*>(jl_array_data(array))[i] != 0);
+            }
+            else
+            {
+                out.reserve(n);
+                for (size_t i = 0; i < n; ++i)
+                    out.push_back(unbox<T>(jl_arrayref(array, i)));
+            }
+
+            return out;
+        }
+
+        /// @brief julia-side Vector{Symbol}, unrooted
+        jl_value_t* to_symbol_vector(const std::vector<std::string>& names)
+        {
+            auto* out = jl_alloc_array_1d(jl_apply_array_type((jl_value_t*) jl_symbol_type, 1), names.size());
+
+            for (size_t i = 0; i < names.size(); ++i)
+                jl_arrayset(out, (jl_value_t*) jl_symbol(names.at(i).c_str()), i);
+
+            return (jl_value_t*) out;
+        }
+    }
+
+    template<Boxable... Ts>
+    jl_value_t* box_columns(const Column<Ts>&... columns)
+    {
+        THROW_IF_UNINITIALIZED;
+
+        jl_function_t* new_table = detail::cached([&]() -> jl_function_t* { return get_function("jluna.table_handler", "new_table"); });
+
+        auto before = jl_gc_is_enabled();
+        jl_gc_enable(false);
+
+        jl_value_t* out;
+        try
+        {
+            out = safe_call(new_table, detail::to_symbol_vector({columns.name...}), detail::box_column<Ts>(columns.data)...);
+        }
+        catch (...)
+        {
+            jl_gc_enable(before);
+            throw;
+        }
+
+        jl_gc_enable(before);
+        return out;
+    }
+
+    template<Unboxable... Ts, typename... Names_t>
+        requires (sizeof...(Ts) == sizeof...(Names_t) and (std::is_convertible_v<Names_t, std::string> and ...))
+    std::tuple<std::vector<Ts>...> unbox_columns(jl_value_t* table, const Names_t&... names)
+    {
+        THROW_IF_UNINITIALIZED;
+
+        jl_function_t* get_columns = detail::cached([&]() -> jl_function_t* { return get_function("jluna.table_handler", "get_columns"); });
+
+        auto before = jl_gc_is_enabled();
+        jl_gc_enable(false);
+
+        try
+        {
+            jl_value_t* columns = safe_call(get_columns, table, detail::to_symbol_vector({std::string(names)...}), detail::column_type<Ts>()...);
+
+            auto out = [&]<size_t... Is>(std::index_sequence<Is...>) {
+                return std::tuple<std::vector<Ts>...>(detail::unbox_column<Ts>(jl_get_nth_field(columns, Is))...);
+            }(std::index_sequence_for<Ts...>());
+
+            jl_gc_enable(before);
+            return out;
+        }
+        catch (...)
+        {
+            jl_gc_enable(before);
+            throw;
+        }
+    }
+}
@@ -75,19 +75,19 @@ namespace jluna
 
     Type::operator std::string() const
     {
-        static jl_function_t* to_string = jl_get_function(jl_base_module, "string");
+        jl_function_t* to_string = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "string"); });
         return std::string(jl_string_data(jl_call1(to_string, _content->value())));
     }
 
     bool Type::operator==(const Type& other) const
     {
-        static jl_function_t* equals = jl_get_function(jl_base_module, "==");
+        jl_function_t* equals = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "=="); });
         return jl_unbox_bool(jl_call2(equals, this->_content->value(), other._content->value()));
     }
 
     bool Type::operator!=(const Type& other) const
     {
-        static jl_function_t* not_equals = jl_get_function(jl_base_module, "!=");
+        jl_function_t* not_equals = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_base_module, "!="); });
         return jl_unbox_bool(jl_call2(not_equals, this->_content->value(), other._content->value()));
     }
      */
@@ -0,0 +1,51 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 23.02.22 by clem (mail@clemens-cords.com)
+//
+
+namespace jluna
+{
+    template<IsJuliaBits T>
+    jl_datatype_t* to_julia_type()
+    {
+        if constexpr (std::is_same_v<T, Bool>)
+            return jl_bool_type;
+        else if constexpr (std::is_same_v<T, Int8>)
+            return jl_int8_type;
+        else if constexpr (std::is_same_v<T, Int16>)
+            return jl_int16_type;
+        else if constexpr (std::is_same_v<T, Int32>)
+            return jl_int32_type;
+        else if constexpr (std::is_same_v<T, Int64>)
+            return jl_int64_type;
+        else if constexpr (std::is_same_v<T, UInt8>)
+            return jl_uint8_type;
+        else if constexpr (std::is_same_v<T, UInt16>)
+            return jl_uint16_type;
+        else if constexpr (std::is_same_v<T, UInt32>)
+            return jl_uint32_type;
+        else if constexpr (std::is_same_v<T, UInt64>)
+            return jl_uint64_type;
+        else if constexpr (std::is_same_v<T, Float32>)
+            return jl_float32_type;
+        else
+            return jl_float64_type;
+    }
+
+    namespace detail
+    {
+        template<typename Lookup_t>
+        auto cached(Lookup_t lookup) -> decltype(lookup())
+        {
+            static std::atomic<decltype(lookup())> cache = nullptr;
+
+            auto out = cache.load(std::memory_order_acquire);
+            if (out == nullptr)
+            {
+                out = lookup();
+                cache.store(out, std::memory_order_release);
+            }
+            return out;
+        }
+    }
+}
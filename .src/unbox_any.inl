@@ -13,6 +13,7 @@
 #include <utility>
 #include <.src/common.hpp>
 #include <exceptions.hpp>
+#include <conversion.hpp>
 
 namespace jluna
 {
@@ -32,7 +33,7 @@ namespace jluna
     template<typename T, std::enable_if_t<std::is_same_v<T, char>, bool>>
     T unbox(jl_value_t* value)
     {
-        static jl_function_t* convert = jl_get_function(jl_main_module, "convert");
+        jl_function_t* convert = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_main_module, "convert"); });
 
         if (jl_isa(value, (jl_value_t*) jl_uint8_type))
                 return char(jl_unbox_uint8(value));
@@ -116,7 +117,7 @@ namespace jluna
         if (jl_isa(value, (jl_value_t*) jl_string_type))
             return std::string(jl_string_data(value));
 
-        static jl_function_t* to_string = jl_get_function(jl_main_module, "string");
+        jl_function_t* to_string = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_main_module, "string"); });
         return std::string(jl_string_data(safe_call(to_string, value)));
     }
 
@@ -126,7 +127,7 @@ namespace jluna
         if (jl_isa(value, (jl_value_t*) jl_string_type))
             return jl_string_data(value);
 
-        static jl_function_t* to_string = jl_get_function(jl_main_module, "string");
+        jl_function_t* to_string = detail::cached([&]() -> jl_function_t* { return jl_get_function(jl_main_module, "string"); });
         return jl_string_data(safe_call(to_string, value));
     }
 
@@ -155,6 +156,17 @@ namespace jluna
     template<typename T, typename U, std::enable_if_t<std::is_same_v<T, std::vector<U>>, bool>>
     T unbox(jl_value_t* value)
     {
+        if constexpr (IsJuliaBits<U> and not std::is_same_v<U, Bool>)
+        {
+            // bulk conversion for vectors of numbers, falls back to element-wise below if not representable
+            if (jl_is_array(value) and jl_array_ndims(value) == 1)
+            {
+                std::vector<U> out(jl_array_len(value));
+                if (detail::convert_elements((jl_array_t*) value, out.data()))
+                    return out;
+            }
+        }
+
         value = try_convert(value, "Vector");
 
         std::vector<U> out;
@@ -184,7 +196,7 @@ namespace jluna
         template<typename Tuple_t, typename Value_t, size_t i>
         void unbox_tuple_aux_aux(Tuple_t& tuple, jl_value_t* value)
         {
-            static jl_function_t* tuple_at = (jl_function_t*) jl_eval_string("jluna.tuple_at");
+            jl_function_t* tuple_at = detail::cached([&]() -> jl_function_t* { return (jl_function_t*) jl_eval_string("jluna.tuple_at"); });
             auto* v = safe_call(tuple_at, value, jl_box_uint64(i + 1));
             std::get<i>(tuple) = unbox<std::tuple_element_t<i, Tuple_t>>(v);
         }
@@ -223,7 +235,7 @@ namespace jluna
     {
         assert_type(value, "AbstractDict");
 
-        static jl_function_t* serialize = jl_get_function((jl_module_t*) jl_eval_string("return jluna"), "serialize");
+        jl_function_t* serialize = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return jluna"), "serialize"); });
 
         jl_array_t* as_array = (jl_array_t*) safe_call(serialize, value);
 
@@ -238,7 +250,7 @@ namespace jluna
     {
         value = try_convert(value, "Set");
 
-        static jl_function_t* serialize = jl_get_function((jl_module_t*) jl_eval_string("return jluna"), "serialize");
+        jl_function_t* serialize = detail::cached([&]() -> jl_function_t* { return jl_get_function((jl_module_t*) jl_eval_string("return jluna"), "serialize"); });
         jl_array_t* as_array = (jl_array_t*) safe_call(serialize, value);
 
         std::set<U> out;
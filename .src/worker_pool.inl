@@ -0,0 +1,96 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 27.02.22 by clem (mail@clemens-cords.com)
+//
+
+#include <worker_pool.hpp>
+#include <.src/common.hpp>
+#include <iostream>
+
+namespace jluna
+{
+    namespace detail
+    {
+        jl_value_t* new_worker_pool(size_t n_workers)
+        {
+            THROW_IF_UNINITIALIZED;
+            assert(n_workers > 0);
+
+            State::safe_script("import Distributed, SharedArrays");
+
+            jl_function_t* new_worker_pool = detail::cached([&]() -> jl_function_t* { return get_function("jluna.distributed_handler", "new_worker_pool"); });
+            return safe_call(new_worker_pool, jl_box_uint64(n_workers));
+        }
+    }
+
+    WorkerPool::WorkerPool(size_t n_workers)
+        : _pool(detail::new_worker_pool(n_workers), nullptr), _n_workers(n_workers)
+    {}
+
+    WorkerPool::~WorkerPool()
+    {
+        jl_function_t* remove_worker_pool = detail::cached([&]() -> jl_function_t* { return get_function("jluna.distributed_handler", "remove_worker_pool"); });
+        jl_call1(remove_worker_pool, (jl_value_t*) _pool);
+
+        // destructors may not throw, so report and continue
+        if (jl_exception_occurred())
+        {
+            std::cerr << "In WorkerPool::~WorkerPool: failed to shut down workers: " << jl_typeof_str(jl_exception_occurred()) << std::endl;
+            jl_exception_clear();
+        }
+    }
+
+    size_t WorkerPool::size() const
+    {
+        return _n_workers;
+    }
+
+    void WorkerPool::script(const std::string& command)
+    {
+        jl_function_t* script = detail::cached([&]() -> jl_function_t* { return get_function("jluna.distributed_handler", "script"); });
+        safe_call(script, (jl_value_t*) _pool, jl_cstr_to_string(command.c_str()));
+    }
+
+    template<typename Return_t, Boxable... Args_t>
+    Return_t WorkerPool::call(Proxy<State>& function, Args_t&&... args)
+    {
+        jl_function_t* remote_call = detail::cached([&]() -> jl_function_t* { return get_function("jluna.distributed_handler", "remote_call"); });
+        jl_function_t* safe_call = detail::cached([&]() -> jl_function_t* { return get_function("jluna.exception_handler", "safe_call"); });
+
+        auto before = jl_gc_is_enabled();
+        jl_gc_enable(false);
+
+        std::vector<jl_value_t*> params = {(jl_value_t*) remote_call, (jl_value_t*) _pool, (jl_value_t*) function};
+        (params.push_back(box(std::forward<Args_t>(args))), ...);
+
+        // nothing allocates between here and jl_call, which roots its arguments, so the gc may run while waiting on the worker
+        jl_gc_enable(before);
+        auto* result = jl_call(safe_call, params.data(), params.size());
+        forward_last_exception();
+
+        if constexpr (std::is_same_v<Return_t, Proxy<State>>)
+        {
+            jl_gc_enable(false);
+            auto out = Proxy<State>(result, nullptr);
+            jl_gc_enable(before);
+            return out;
+        }
+        else
+            return unbox<Return_t>(result);
+    }
+
+    template<typename Return_t, Boxable... Args_t>
+    std::future<Return_t> WorkerPool::call_async(Proxy<State>& function, Args_t&&... args)
+    {
+        jl_function_t* remote_call = detail::cached([&]() -> jl_function_t* { return get_function("jluna.distributed_handler", "remote_call"); });
+
+        return State::async_call<Return_t>(remote_call, true, (jl_value_t*) _pool, (jl_value_t*) function, std::forward<Args_t>(args)...);
+    }
+
+    template<Boxable Value_t, size_t Rank>
+    Proxy<State> WorkerPool::share(Array<Value_t, Rank>& array)
+    {
+        jl_function_t* share = detail::cached([&]() -> jl_function_t* { return get_function("jluna.distributed_handler", "share"); });
+        return Proxy<State>(safe_call(share, (jl_value_t*) _pool, (jl_value_t*) array), nullptr);
+    }
+}
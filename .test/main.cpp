@@ -14,6 +14,7 @@
 #include <array_proxy.hpp>
 
 #include <thread>
+#include <cstdio>
 
 #include <.test/test.hpp>
 #include <type_traits>
@@ -23,6 +24,19 @@
 
 using namespace jluna;
 
+/// @brief minimal coroutine type, runs eagerly and can't be awaited itself
+struct DetachedCoroutine
+{
+    struct promise_type
+    {
+        DetachedCoroutine get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
 int main()
 {
     //State::initialize();
@@ -96,8 +110,870 @@ int main()
             n = jl_unbox_int64(jl_eval_string("return length(jluna.memory_handler._refs.x)"));
         }
 
-        Test::assert_that(n - jl_unbox_int64(jl_eval_string("return length(jluna.memory_handler._refs.x)")) == 2);
-        // 2 bc symbol and value are registered, even for unnamed
+        State::flush_references();
+        Test::assert_that(n - jl_unbox_int64(jl_eval_string("return length(jluna.memory_handler._refs.x)")) == 1);
+    });
+
+    Test::test("proxy deferred free", [](){
+
+        State::flush_references();
+        size_t n = jl_unbox_int64(jl_eval_string("return length(jluna.memory_handler._refs.x)"));
+
+        {
+            std::vector<Proxy<State>> proxies;
+            for (size_t i = 0; i < 100; ++i)
+                proxies.emplace_back(jl_eval_string("return [1, 2, 3, 4]"), nullptr);
+        }
+
+        Test::assert_that(jl_unbox_int64(jl_eval_string("return length(jluna.memory_handler._refs.x)")) > n);
+
+        State::flush_references();
+        Test::assert_that(jl_unbox_int64(jl_eval_string("return length(jluna.memory_handler._refs.x)")) == n);
+    });
+
+    Test::test("state: multi-threaded calls", [](){
+
+        State::flush_references();
+        size_t n = jl_unbox_int64(jl_eval_string("return length(jluna.memory_handler._refs.x)"));
+
+        std::vector<std::thread> workers;
+        std::vector<size_t> results(8, 0);
+
+        for (size_t i = 0; i < results.size(); ++i)
+            workers.emplace_back([i, &results](){
+
+                State::adopt_thread();
+
+                for (size_t j = 0; j < 100; ++j)
+                {
+                    auto proxy = Main["Base"]["sum"];
+                    results.at(i) = proxy(std::vector<size_t>{i, j});
+                }
+            });
+
+        {
+            // workers may trigger a collection, which has to be able to proceed while this thread waits
+            GCSafeRegion region;
+            for (auto& worker : workers)
+                worker.join();
+        }
+
+        for (size_t i = 0; i < results.size(); ++i)
+            Test::assert_that(results.at(i) == i + 99);
+
+        State::flush_references();
+        Test::assert_that(jl_unbox_int64(jl_eval_string("return length(jluna.memory_handler._refs.x)")) == n);
+    });
+
+    Test::test("state: async call", [](){
+
+        // tasks may end up on this thread, so julia has to run while waiting
+        auto wait = [](auto& future) {
+            while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                State::run_for(std::chrono::milliseconds(1));
+        };
+
+        auto* sqrt = jl_get_function(jl_base_module, "sqrt");
+
+        std::vector<std::future<Float64>> futures;
+        for (size_t i = 0; i < 16; ++i)
+            futures.push_back(State::async_call<Float64>(sqrt, true, Float64(i * i)));
+
+        for (size_t i = 0; i < futures.size(); ++i)
+        {
+            wait(futures.at(i));
+            Test::assert_that(futures.at(i).get() == Float64(i));
+        }
+
+        auto proxy_future = Main["Base"]["sqrt"].call_async(Float64(16));
+        wait(proxy_future);
+        auto proxy = proxy_future.get();
+        Test::assert_that(proxy.operator Float64() == 4);
+
+        bool thrown = false;
+        try
+        {
+            auto future = State::async_call<Float64>(sqrt, true, Float64(-1));
+            wait(future);
+            future.get();
+        }
+        catch (JuliaException& e)
+        {
+            thrown = true;
+        }
+
+        Test::assert_that(thrown);
+
+        // spawned tasks run on other threads, so get() may block without pumping
+        if (jl_unbox_int64(jl_eval_string("return Threads.nthreads()")) > 1)
+        {
+            auto future = State::async_call<Float64>(sqrt, true, Float64(9));
+
+            Float64 result;
+            {
+                GCSafeRegion region;
+                result = future.get();
+            }
+            Test::assert_that(result == 3);
+        }
+    });
+
+    Test::test("awaitable: co_await", [](){
+
+        std::promise<Float64> result;
+        std::promise<bool> thrown;
+
+        auto coroutine = [&]() -> DetachedCoroutine {
+
+            auto* sqrt = jl_get_function(jl_base_module, "sqrt");
+            result.set_value(co_await Awaitable<Float64>(sqrt, true, Float64(16)));
+
+            try
+            {
+                co_await Awaitable<Float64>(sqrt, true, Float64(-1));
+                thrown.set_value(false);
+            }
+            catch (JuliaException& e)
+            {
+                thrown.set_value(true);
+            }
+        };
+
+        auto result_future = result.get_future();
+        auto thrown_future = thrown.get_future();
+
+        coroutine();
+
+        // the awaited tasks may end up on this thread, so julia has to run while waiting
+        while (thrown_future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            State::run_for(std::chrono::milliseconds(1));
+
+        Test::assert_that(result_future.get() == 4);
+        Test::assert_that(thrown_future.get());
+    });
+
+    Test::test("mpsc queue: multiple producers", [](){
+
+        MPSCQueue<size_t> queue;
+        std::vector<std::thread> producers;
+
+        for (size_t i = 0; i < 4; ++i)
+            producers.emplace_back([i, &queue](){
+                for (size_t j = 0; j < 1000; ++j)
+                    queue.push(i * 1000 + j);
+            });
+
+        std::vector<size_t> last(4, 0);
+        std::vector<size_t> count(4, 0);
+        size_t n = 0;
+        size_t value;
+
+        while (n < 4000)
+        {
+            if (not queue.try_pop(value))
+                continue;
+
+            size_t producer = value / 1000;
+            Test::assert_that(count.at(producer) == 0 or value > last.at(producer));    // per-producer order is kept
+            last.at(producer) = value;
+            count.at(producer) += 1;
+            n += 1;
+        }
+
+        for (auto& producer : producers)
+            producer.join();
+
+        Test::assert_that(not queue.try_pop(value));
+    });
+
+    Test::test("channel: julia consumer", [](){
+
+        auto channel = Channel<Int64>(64);
+        Test::assert_that(channel.capacity() == 64);
+
+        std::thread producer([&](){
+            for (Int64 i = 1; i <= 10000; ++i)
+                channel.push(i);
+
+            channel.close();
+        });
+
+        auto* sum = jl_get_function(jl_base_module, "sum");
+        Int64 result = unbox<Int64>(State::safe_call(sum, (jl_value_t*) channel));
+        producer.join();
+
+        Test::assert_that(result == 10000 * 10001 / 2);
+    });
+
+    Test::test("channel: julia producer", [](){
+
+        auto channel = Channel<std::string>(128);
+
+        State::safe_script(R"(
+            function produce_strings(channel)
+                for i in 1:100
+                    put!(channel, string(i))
+                end
+                close(channel)
+            end
+        )");
+
+        State::safe_call(jl_get_function(jl_main_module, "produce_strings"), (jl_value_t*) channel);
+
+        size_t n = 0;
+        while (auto value = channel.pop())
+        {
+            n += 1;
+            Test::assert_that(value.value() == std::to_string(n));
+        }
+
+        Test::assert_that(n == 100);
+        Test::assert_that(not channel.try_push("101"));
+    });
+
+    Test::test("state: poll", [](){
+
+        State::safe_script(R"(
+            poll_counter = 0
+            for i in 1:10
+                @async global poll_counter += 1
+            end
+        )");
+
+        size_t n = 0;
+        while (State::safe_return<Int64>("poll_counter") < 10)
+            n += State::poll(1);
+
+        Test::assert_that(n >= 10);
+        Test::assert_that(State::poll() == 0);
+    });
+
+    Test::test("state: run_for", [](){
+
+        State::safe_script(R"(
+            timer_fired = false
+            Timer(_ -> global timer_fired = true, 0.01)
+        )");
+
+        Test::assert_that(not State::safe_return<bool>("timer_fired"));
+        State::run_for(std::chrono::milliseconds(50));
+        Test::assert_that(State::safe_return<bool>("timer_fired"));
+    });
+
+    Test::test("safe_script_for: timeout", [](){
+
+        bool thrown = false;
+        try
+        {
+            State::safe_script_for("while true; sleep(0.001) end", std::chrono::milliseconds(50));
+        }
+        catch (const TimeoutException& e)
+        {
+            thrown = true;
+        }
+
+        Test::assert_that(thrown);
+
+        // state stays usable and no interrupt is left pending
+        Test::assert_that(State::safe_script_for("return 1 + 1", std::chrono::seconds(1)).operator Int64() == 2);
+        Test::assert_that(State::safe_script("sleep(0.1); return 1").operator Int64() == 1);
+    });
+
+    Test::test("safe_call_for: timeout", [](){
+
+        State::safe_script(R"(
+            function slow_add(a, b)
+                sleep(10)
+                return a + b
+            end
+        )");
+
+        bool thrown = false;
+        try
+        {
+            Main["slow_add"].safe_call_for(std::chrono::milliseconds(50), 1, 2);
+        }
+        catch (const TimeoutException& e)
+        {
+            thrown = true;
+        }
+
+        Test::assert_that(thrown);
+        Test::assert_that(Main["Base"]["+"].safe_call_for(std::chrono::seconds(1), 1, 2).operator Int64() == 3);
+    });
+
+    Test::test("C: gc-safe function", [](){
+
+        register_function("gc_safe_sum", [](jl_value_t* in) -> Int64 {
+
+            auto* data = (Int64*) jl_array_data(in);
+            Int64 sum = 0;
+            for (size_t i = 0; i < jl_array_len(in); ++i)
+                sum += data[i];
+
+            {
+                GCUnsafeRegion region;
+                State::safe_script("gc_safe_touched = true");
+            }
+
+            return sum;
+        }, true);
+
+        auto result = State::safe_script(R"(
+            Threads.@spawn GC.gc()
+            return cppcall(:gc_safe_sum, collect(1:100))
+        )");
+
+        Test::assert_that(result.operator Int64() == 5050);
+        Test::assert_that(State::safe_return<bool>("gc_safe_touched"));
+    });
+
+    Test::test("parallel_map: julia function", [](){
+
+        auto array = Array<Int64, 2>(State::safe_script("return reshape(collect(1:1000), 10, 100)"));
+        auto square = State::safe_script("return x -> x^2");
+
+        auto result = parallel_map<Int64>(square, array);
+
+        Test::assert_that(result.size() == 1000);
+        Test::assert_that(result.at(9, 99).operator Int64() == 1000 * 1000);
+        Test::assert_that(result[3].operator Int64() == 16);
+    });
+
+    Test::test("parallel_map: C++ lambda", [](){
+
+        auto array = Array<Int64, 1>(State::safe_script("return collect(1:1000)"));
+
+        auto result = parallel_map<Int64>([](jl_value_t* in) -> Int64 {
+            return 2 * jl_unbox_int64(in);
+        }, array);
+
+        for (size_t i = 0; i < 1000; ++i)
+            Test::assert_that(result[i].operator Int64() == 2 * (i + 1));
+
+        std::atomic<Int64> sum = 0;
+        parallel_for([&sum](jl_value_t* in) -> void {
+            sum += jl_unbox_int64(in);
+        }, array, 0, true);
+
+        Test::assert_that(sum == 1000 * 1001 / 2);
+    });
+
+    Test::test("worker pool: call", [](){
+
+        auto pool = WorkerPool(2);
+        Test::assert_that(pool.size() == 2);
+
+        pool.script("jluna_test_worker_f(xs) = Distributed.myid() => sum(xs)");
+        auto f = Main["jluna_test_worker_f"];
+
+        auto small = Array<Int64, 1>(State::safe_script("return collect(1:10)"));
+        auto large = Array<Int64, 1>(State::safe_script("return collect(1:10000)"));
+
+        auto res = pool.call<std::pair<Int64, Int64>>(f, small);
+        Test::assert_that(res.first != 1 and res.second == 55);
+
+        auto future = pool.call_async<std::pair<Int64, Int64>>(f, large);
+        while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            State::run_for(std::chrono::milliseconds(1));
+
+        res = future.get();
+        Test::assert_that(res.first != 1 and res.second == 10000 * 10001 / 2);
+
+        auto length = Main["Base"]["length"];
+        auto shared = pool.share(large);
+        Test::assert_that(pool.call<Int64>(length, shared) == 10000);
+    });
+
+    Test::test("mmap_array: shared mapping", [](){
+
+        auto path = std::string("/tmp/jluna_test_mmap_array");
+        std::remove(path.c_str());
+
+        {
+            auto first = mmap_array<Float64, 2>(path, {100, 100});
+            auto second = mmap_array<Float64, 2>(path, {100, 100}, false);
+
+            Test::assert_that(first.data() != second.data());
+
+            for (size_t i = 0; i < 100 * 100; ++i)
+                first.data()[i] = i;
+
+            Test::assert_that(second.data()[1234] == 1234);
+            Test::assert_that(second.at(34, 12).operator Float64() == 1234);
+            Test::assert_that(Main["Base"]["sum"](second).operator Float64() == 9999.0 * 10000 / 2);
+        }
+
+        bool thrown = false;
+        try
+        {
+            mmap_array<Float64, 2>(path, {1000, 1000}, false);
+        }
+        catch (const JuliaException&)
+        {
+            thrown = true;
+        }
+
+        Test::assert_that(thrown);
+        std::remove(path.c_str());
+    });
+
+    Test::test("adopt: no copy", [](){
+
+        auto* data = new Float64[6]{1, 2, 3, 4, 5, 6};
+        bool deleted = false;
+
+        {
+            auto array = adopt<Float64, 2>(data, {2, 3}, [&deleted](Float64* ptr) {
+                delete[] ptr;
+                deleted = true;
+            });
+
+            Test::assert_that(array.data() == data);
+            Test::assert_that(array.at(1, 2).operator Float64() == 6);
+
+            array.data()[0] = 9999;
+            Test::assert_that(data[0] == 9999);
+        }
+
+        State::flush_references();
+        State::collect_garbage();
+        Test::assert_that(deleted);
+
+        auto vector = std::vector<Int64>{1, 2, 3, 4};
+        const Int64* before = vector.data();
+
+        auto moved = Array<Int64, 1>(box(std::move(vector)));
+        Test::assert_that(moved.data() == before);
+        Test::assert_that(Main["Base"]["sum"](moved).operator Int64() == 10);
+
+        Int64 borrowed_data[3] = {1, 2, 3};
+        auto borrowed = borrow<Int64, 1>(borrowed_data, {3});
+        borrowed[1] = 9999;
+        Test::assert_that(borrowed_data[1] == 9999);
+    });
+
+    Test::test("allocator: shared memory", [](){
+
+        auto vector = std::vector<Int64, jluna::allocator<Int64>>();
+        vector.reserve(16);
+
+        for (Int64 i = 0; i < 10; ++i)
+            vector.push_back(i);
+
+        State::safe_script("f!(xs) = (xs .*= 2; return length(xs))");
+        Test::assert_that(Main["f!"](vector).operator Int64() == 10);
+
+        for (Int64 i = 0; i < 10; ++i)
+            Test::assert_that(vector.at(i) == 2 * i);
+
+        auto array = Vector<Int64>(box(vector));
+        Test::assert_that(array.data() == vector.data());
+
+        vector.resize(10000);
+        Test::assert_that(vector.at(9) == 18);
+    });
+
+    Test::test("stream: batched iteration", [](){
+
+        auto generator = State::safe_script("return (Int32(x) for x in 1:10000 if x % 2 == 0)");
+
+        Int64 sum = 0;
+        size_t n = 0;
+        for (Int64 x : Stream<Int64>(generator, 128))
+        {
+            sum += x;
+            n += 1;
+        }
+
+        Test::assert_that(n == 5000);
+        Test::assert_that(sum == 2 * (5000 * 5001 / 2));
+
+        auto dict = State::safe_script("return Dict(\"a\" => 1)");
+        for (auto& pair : Stream<std::pair<std::string, Int64>>(dict))
+            Test::assert_that(pair.second == 1);
+
+        auto empty = State::safe_script("return Int64[]");
+        auto stream = Stream(empty);
+        Test::assert_that(stream.begin() == stream.end());
+
+        auto strings = State::safe_script("return Channel{String}(c -> foreach(i -> put!(c, string(i)), 1:3))");
+        std::vector<std::string> collected;
+        for (auto& s : Stream<std::string>(strings, 2))
+            collected.push_back(s);
+
+        Test::assert_that(collected.size() == 3 and collected.at(2) == "3");
+    });
+
+    Test::test("generator: julia iteration", [](){
+
+        Int64 i = 0;
+        auto generator = Generator<Int64>([&i]() -> std::optional<Int64> {
+            if (i == 10000)
+                return std::nullopt;
+
+            return ++i;
+        }, 128);
+
+        Test::assert_that(Main["Base"]["sum"]((jl_value_t*) generator).operator Int64() == 10000 * 10001 / 2);
+        Test::assert_that(Main["Base"]["sum"]((jl_value_t*) generator).operator Int64() == 0);
+
+        Float64 next = 0;
+        auto chunked = Generator<Float64>([&next](Float64* buffer, size_t capacity) -> size_t {
+            size_t n = 0;
+            for (; n < capacity and next < 1000; ++n)
+                buffer[n] = next++;
+
+            return n;
+        }, 100);
+
+        Test::assert_that(Main["Base"]["length"](Main["Base"]["collect"]((jl_value_t*) chunked)).operator Int64() == 1000);
+
+        size_t count = 0;
+        auto strings = Generator<std::string>([&count]() -> std::optional<std::string> {
+            if (count++ == 3)
+                return std::nullopt;
+
+            return std::to_string(count);
+        });
+
+        State::safe_script("join_all(xs) = join(xs, \",\")");
+        Test::assert_that(Main["join_all"]((jl_value_t*) strings).operator std::string() == "1,2,3");
+
+        auto throwing = Generator<Int64>([]() -> std::optional<Int64> {
+            throw std::runtime_error("abc");
+        });
+
+        bool thrown = false;
+        try
+        {
+            Main["Base"]["collect"]((jl_value_t*) throwing);
+        }
+        catch (const JuliaException&)
+        {
+            thrown = true;
+        }
+
+        Test::assert_that(thrown);
+    });
+
+    Test::test("table: columns", [](){
+
+        auto ids = std::vector<Int64>{1, 2, 3};
+        auto prices = std::vector<Float64>{1.5, 2.5, 3.5};
+        auto names = std::vector<std::string>{"a", "b", "c"};
+
+        auto table = Proxy<State>(box_columns(
+            Column<Int64>{"id", ids},
+            Column<Float64>{"price", prices},
+            Column<std::string>{"name", names}
+        ), nullptr);
+
+        auto expected = State::safe_script("return NamedTuple{(:id, :price, :name), Tuple{Vector{Int64}, Vector{Float64}, Vector{String}}}");
+        Test::assert_that(jl_types_equal((jl_value_t*) expected, jl_typeof((jl_value_t*) table)));
+
+        auto [out_ids, out_prices, out_names] = unbox_columns<Int32, Float64, std::string>(table, "id", "price", "name");
+        Test::assert_that(out_ids == std::vector<Int32>{1, 2, 3});
+        Test::assert_that(out_prices == prices);
+        Test::assert_that(out_names == names);
+
+        auto uneven = std::vector<Int64>{1};
+
+        bool thrown = false;
+        try
+        {
+            box_columns(Column<Int64>{"a", ids}, Column<Int64>{"b", uneven});
+        }
+        catch (const JuliaException&)
+        {
+            thrown = true;
+        }
+
+        Test::assert_that(thrown);
+    });
+
+    Test::test("matrix view: layout", [](){
+
+        auto array = Array<Float64, 2>(State::safe_script("return Matrix{Float64}(reshape(1:12, 3, 4))"));
+        auto view = MatrixView<Float64>(array);
+
+        Test::assert_that(view.extent(0) == 3 and view.extent(1) == 4);
+        Test::assert_that(view.stride(0) == 1 and view.stride(1) == 3);
+        Test::assert_that(view(1, 2) == 8);
+
+        view(1, 2) = 9999;
+        Test::assert_that(array.at(1, 2).operator Float64() == 9999);
+        view(1, 2) = 8;
+
+        auto block = view.submatrix(1, 1, 2, 2);
+        Test::assert_that(block.leading_dimension() == 3 and not block.is_contiguous());
+        Test::assert_that(block(0, 0) == 5);
+
+        auto as_julia = block.as_julia();
+        Test::assert_that(Main["Base"]["sum"](as_julia).operator Float64() == 5 + 6 + 8 + 9);
+        Test::assert_that(Main["Base"]["length"](as_julia).operator Int64() == 4);
+
+        // padded views stay strided julia-side
+        auto strides = Main["Base"]["strides"](as_julia);
+        Test::assert_that(strides[0].operator Int64() == 1 and strides[1].operator Int64() == 3);
+        Test::assert_that(Main["Base"]["sum"](view.submatrix(2, 2, 1, 2).as_julia()).operator Float64() == 9 + 12);
+
+        bool thrown = false;
+        try
+        {
+            view.submatrix(2, 2, 2, 2);
+        }
+        catch (const std::out_of_range&)
+        {
+            thrown = true;
+        }
+
+        Test::assert_that(thrown);
+    });
+
+    Test::test("strided view: subarray", [](){
+
+        State::safe_script("jluna_test_strided = Matrix{Float64}(reshape(1:20, 4, 5))");
+
+        auto column = StridedView<Float64, 1>(State::safe_script("return view(jluna_test_strided, :, 3)"));
+        Test::assert_that(column.size() == 4 and column.is_contiguous());
+        Test::assert_that(column[0] == 9);
+
+        auto row = StridedView<Float64, 1>(State::safe_script("return view(jluna_test_strided, 2, :)"));
+        Test::assert_that(row.stride(0) == 4 and not row.is_contiguous());
+        Test::assert_that(row[4] == 18);
+
+        row[4] = 9999;
+        Test::assert_that(State::safe_script("return jluna_test_strided[2, 5]").operator Float64() == 9999);
+
+        auto reversed = StridedView<Float64, 1>(State::safe_script("return view(vec(jluna_test_strided), 20:-1:1)"));
+        Test::assert_that(reversed.stride(0) == -1 and reversed[19] == 1);
+
+        auto block = StridedView<Float64, 2>(State::safe_script("return view(jluna_test_strided, 2:3, 2:4)"));
+        Test::assert_that(block(1, 2) == 15);
+
+        auto matrix = block.as_matrix();
+        Test::assert_that(matrix.leading_dimension() == 4 and matrix(1, 2) == 15);
+
+        auto reshaped = StridedView<Float64, 2>(State::safe_script("return reshape(view(vec(jluna_test_strided), 1:20), 5, 4)"));
+        Test::assert_that(reshaped(4, 0) == 5);
+
+        bool thrown = false;
+        try
+        {
+            StridedView<Float64, 1>(State::safe_script("return 1.0:10.0"));
+        }
+        catch (const JuliaException&)
+        {
+            thrown = true;
+        }
+
+        Test::assert_that(thrown);
+    });
+
+    Test::test("range: lazy elements", [](){
+
+        auto range = Range<Int64>(State::safe_script("return 1:10^9"));
+        Test::assert_that(range.size() == 1000000000);
+        Test::assert_that(range[999999999] == 1000000000);
+
+        auto stepped = Range<Int64>(State::safe_script("return 10:-3:1"));
+        std::vector<Int64> elements;
+        for (auto x : stepped)
+            elements.push_back(x);
+
+        Test::assert_that(elements == std::vector<Int64>{10, 7, 4, 1});
+        Test::assert_that(stepped.last() == 1);
+
+        auto floats = Range<Float64>(State::safe_script("return 0.0:0.5:2.0"));
+        Test::assert_that(floats.size() == 5 and floats[3] == 1.5);
+    });
+
+    Test::test("numeric: algorithms", [](){
+
+        auto a = Array<Float64, 1>(State::safe_script("return Float64.(collect(1:1000))"));
+        auto b = Array<Float64, 1>(State::safe_script("return fill(2.0, 1000)"));
+
+        Test::assert_that(numeric::sum(a) == 1000 * 1001 / 2);
+        Test::assert_that(numeric::dot(a, b) == 1000 * 1001);
+        Test::assert_that(numeric::minmax(a) == std::pair<Float64, Float64>(1, 1000));
+
+        numeric::transform(a, b, [](Float64 x) -> Float64 { return -x; });
+        Test::assert_that(b[0].operator Float64() == -1);
+
+        numeric::sort(b);
+        Test::assert_that(b[0].operator Float64() == -1000);
+
+        numeric::sort(b, [](Float64 x, Float64 y) -> bool { return x > y; });
+        Test::assert_that(b[0].operator Float64() == -1);
+
+        auto c = Array<Int32, 1>(State::safe_script("return zeros(Int32, 1000)"));
+        numeric::convert(a, c);
+        Test::assert_that(c[999].operator Int32() == 1000);
+
+        numeric::fill(c, Int32(7));
+        Test::assert_that(c[0].operator Int32() == 7 and c[999].operator Int32() == 7);
+
+        // narrow integers are accumulated as Int64, like Base.sum
+        auto narrow = Array<Int8, 1>(State::safe_script("return fill(Int8(100), 1000)"));
+        Test::assert_that(numeric::sum(narrow) == Main["Base"]["sum"](narrow).operator Int64());
+        Test::assert_that(numeric::sum(narrow) == 100000);
+
+        auto empty = Array<Float64, 1>(State::safe_script("return Float64[]"));
+        Test::assert_that(numeric::sum(empty) == 0);
+
+        bool thrown = false;
+        try
+        {
+            numeric::minmax(empty);
+        }
+        catch (const std::invalid_argument&)
+        {
+            thrown = true;
+        }
+
+        Test::assert_that(thrown);
+    });
+
+    Test::test("conversion: bulk", [](){
+
+        auto convert_pair = []<typename From, typename To>() -> bool {
+            From in[2] = {From(0), From(1)};
+            To out[2];
+            return convert_elements(in, out, 2) and out[0] == To(0) and out[1] == To(1);
+        };
+
+        using types = std::tuple<Bool, Int8, Int16, Int32, Int64, UInt8, UInt16, UInt32, UInt64, Float32, Float64>;
+        bool all_pairs = []<typename... Ts>(auto convert_pair, std::tuple<Ts...>*) {
+            auto convert_from = [&]<typename From>() -> bool {
+                return (convert_pair.template operator()<From, Ts>() and ...);
+            };
+            return (convert_from.template operator()<Ts>() and ...);
+        }(convert_pair, (types*) nullptr);
+
+        Test::assert_that(all_pairs);
+
+        Float64 not_integer[1] = {1.5};
+        Int64 out[1] = {0};
+        Test::assert_that(not convert_elements(not_integer, out, 1) and out[0] == 0);
+
+        Int64 negative[1] = {-1};
+        UInt64 out_unsigned[1];
+        Test::assert_that(not convert_elements(negative, out_unsigned, 1));
+
+        auto as_double = unbox<std::vector<Float64>>(State::safe_script("return Int32[1, 2, 3]"));
+        Test::assert_that(as_double == std::vector<Float64>{1, 2, 3});
+
+        auto as_int = unbox<std::vector<Int64>>(State::safe_script("return [1.0, 2.0]"));
+        Test::assert_that(as_int == std::vector<Int64>{1, 2});
+
+        auto boxed = Proxy<State>(box_as<Float64>(std::vector<Float32>{1.5, 2.5}), nullptr);
+        Test::assert_that(jl_types_equal(jl_typeof((jl_value_t*) boxed), jl_apply_array_type((jl_value_t*) jl_float64_type, 1)));
+        Test::assert_that(boxed[1].operator Float64() == 2.5);
+
+        bool thrown = false;
+        try
+        {
+            unbox<std::vector<Int64>>(State::safe_script("return [1.5]"));
+        }
+        catch (const JuliaException&)
+        {
+            thrown = true;
+        }
+
+        Test::assert_that(thrown);
+
+        thrown = false;
+        try
+        {
+            box_as<UInt8>(std::vector<Int64>{256});
+        }
+        catch (const JuliaException&)
+        {
+            thrown = true;
+        }
+
+        Test::assert_that(thrown);
+    });
+
+    Test::test("proxy immortal: no rooting", [](){
+
+        State::flush_references();
+        size_t n = jl_unbox_int64(jl_eval_string("return length(jluna.memory_handler._refs.x)"));
+
+        {
+            auto sqrt = Main["Base"]["sqrt"];
+            auto symbol = Proxy<State>((jl_value_t*) jl_symbol("abc"), nullptr);
+            auto base = Proxy<State>((jl_value_t*) jl_base_module, nullptr);
+            auto nothing = Proxy<State>(jl_nothing, nullptr);
+
+            Test::assert_that(jl_unbox_int64(jl_eval_string("return length(jluna.memory_handler._refs.x)")) == n);
+            Test::assert_that((float) sqrt(4.f) == 2.f);
+        }
+
+        State::flush_references();
+        Test::assert_that(jl_unbox_int64(jl_eval_string("return length(jluna.memory_handler._refs.x)")) == n);
+    });
+
+    Test::test("proxy immortal: only permanently rooted values", [](){
+
+        Test::assert_that(jl_is_immortal(jl_eval_string("return Base.sqrt")));
+        Test::assert_that(jl_is_immortal(jl_nothing) and jl_is_immortal(jl_eval_string("return Main")));
+        Test::assert_that(not jl_is_immortal(jl_eval_string("return Ref(1)")));
+        Test::assert_that(not jl_is_immortal(jl_eval_string("return Base.Threads")));
+        Test::assert_that(not jl_is_immortal((jl_value_t*) jl_int64_type));
+    });
+
+    Test::test("frame: release", [](){
+
+        State::flush_references();
+        size_t n = jl_unbox_int64(jl_eval_string("return length(jluna.memory_handler._refs.x)"));
+
+        {
+            Frame frame;
+            std::vector<Proxy<State>> proxies;
+            for (size_t i = 0; i < 100; ++i)
+                proxies.emplace_back(jl_eval_string("return [1, 2, 3, 4]"), nullptr);
+
+            Test::assert_that(jl_unbox_int64(jl_eval_string("return length(jluna.memory_handler._refs.x)")) == n + 1);
+        }
+
+        State::flush_references();
+        Test::assert_that(jl_unbox_int64(jl_eval_string("return length(jluna.memory_handler._refs.x)")) == n);
+    });
+
+    Test::test("frame: promote", [](){
+
+        std::unique_ptr<Proxy<State>> escaped;
+
+        {
+            Frame frame;
+            auto proxy = Proxy<State>(jl_eval_string("return [99, 2, 3, 4]"), nullptr);
+            proxy.promote();
+            escaped = std::make_unique<Proxy<State>>(proxy);
+        }
+        State::collect_garbage();
+
+        Test::assert_that((int) (*escaped)[0] == 99);
+    });
+
+    Test::test("borrowed proxy: no rooting", [](){
+
+        State::safe_script(R"(
+            struct BorrowedConfig
+                _port
+            end
+
+            config = BorrowedConfig(1234)
+        )");
+
+        State::flush_references();
+        size_t n = jl_unbox_int64(jl_eval_string("return length(jluna.memory_handler._refs.x)"));
+
+        int port = BorrowedProxy<State>(Main)["config"]["_port"];
+
+        Test::assert_that(port == 1234);
+        Test::assert_that(jl_unbox_int64(jl_eval_string("return length(jluna.memory_handler._refs.x)")) == n);
     });
 
     Test::test("proxy inheritance dtor", [](){
@@ -285,6 +1161,18 @@ int main()
         Test::assert_that((int) unnamed_instance["_field"][0] == 999);
     });
 
+    Test::test("proxy mutate member in frame", [](){
+
+        Frame frame;
+
+        auto unnamed_vector = State::safe_script("return [1, 2, 3, 4]");
+        auto element = unnamed_vector[1];
+        element = 999;
+
+        Test::assert_that((int) unnamed_vector[1] == 999);
+        Test::assert_that(element.get_name() == "<unnamed proxy #0>[2]");
+    });
+
     Test::test("proxy detach update", []()
     {
         State::safe_script(R"(
@@ -655,6 +1543,21 @@ int main()
         Test::assert_that(not c_adapter::is_registered(id));
     });
 
+    Test::test("C: reject gc_safe jl_value_t* result", [](){
+
+        bool thrown = false;
+        try
+        {
+            register_function("gc_safe_unrooted", [](jl_value_t* in) -> jl_value_t* { return in; }, true);
+        }
+        catch (const std::invalid_argument&)
+        {
+            thrown = true;
+        }
+
+        Test::assert_that(thrown);
+    });
+
     Test::test("C: reject name", [](){
 
         bool thrown = false;
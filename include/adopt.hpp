@@ -0,0 +1,39 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 28.02.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <functional>
+
+#include <typedefs.hpp>
+#include <array_proxy.hpp>
+
+namespace jluna
+{
+    /// @brief wrap C++-owned memory as a julia-side array without copying, julia takes ownership
+    /// @tparam Value_t: element type, needs to have a julia isbits equivalent
+    /// @tparam Rank: number of dimensions
+    /// @param data: pointer to first element, elements are in column-major order
+    /// @param dims: size of each dimension
+    /// @param deleter: called with data once the julia-side array is garbage collected, possibly from a different thread
+    /// @returns unnamed array proxy
+    /// @note if julia-side resizes the array, its elements are copied into julia-owned memory. data is still only released through deleter
+    template<IsJuliaBits Value_t, size_t Rank, typename Deleter_t>
+        requires std::is_invocable_v<Deleter_t, Value_t*>
+    Array<Value_t, Rank> adopt(Value_t* data, const std::array<size_t, Rank>& dims, Deleter_t deleter);
+
+    /// @brief wrap C++-owned memory as a julia-side array without copying, ownership stays with the caller
+    /// @tparam Value_t: element type, needs to have a julia isbits equivalent
+    /// @tparam Rank: number of dimensions
+    /// @param data: pointer to first element, elements are in column-major order. Needs to stay valid for as long as julia may access the array
+    /// @param dims: size of each dimension
+    /// @returns unnamed array proxy
+    template<IsJuliaBits Value_t, size_t Rank>
+    Array<Value_t, Rank> borrow(Value_t* data, const std::array<size_t, Rank>& dims);
+}
+
+#include ".src/adopt.inl"
@@ -0,0 +1,48 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 01.03.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <vector>
+
+#include <typedefs.hpp>
+
+namespace jluna
+{
+    /// @brief allocator that allocates julia-side vectors, containers using it can be handed to julia without copying, see box
+    /// @tparam T: value type, needs to have a julia isbits equivalent
+    /// @note allocate and deallocate interact with julia, so they may only be called from threads julia knows about
+    template<IsJuliaBits T>
+    class allocator
+    {
+        public:
+            /// @brief value type
+            using value_type = T;
+
+            /// @brief ctor
+            allocator() noexcept = default;
+
+            /// @brief rebind ctor
+            template<IsJuliaBits U>
+            allocator(const allocator<U>&) noexcept;
+
+            /// @brief allocate memory, it is rooted julia-side until deallocated
+            /// @param n: number of elements
+            /// @returns pointer to first element
+            /// @exceptions if julia fails to allocate, std::bad_alloc will be thrown
+            T* allocate(size_t n);
+
+            /// @brief release memory, julia-side arrays sharing it stay valid until they are garbage collected
+            /// @param ptr: pointer returned by allocate
+            /// @param n: number of elements
+            void deallocate(T* ptr, size_t n);
+
+            /// @brief all allocators are interchangeable
+            template<IsJuliaBits U>
+            bool operator==(const allocator<U>&) const noexcept;
+    };
+}
+
+#include ".src/allocator.inl"
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <proxy.hpp>
+#include <typedefs.hpp>
 
 namespace jluna
 {
@@ -34,6 +35,10 @@ namespace jluna
             /// @param name or nulltpr
             Array(jl_value_t*, jl_sym_t* = nullptr);
 
+            /// @brief ctor sharing the content of another proxy, used when downcasting
+            /// @param content
+            explicit Array(const std::shared_ptr<typename Proxy<State>::ProxyValue>& content);
+
             /// @brief linear indexing, no bounds checking
             /// @param index, 0-based
             /// @returns assignable iterator to element
@@ -121,6 +126,14 @@ namespace jluna
             /// @returns true if 0 element, false otherwise
             bool empty() const;
 
+            /// @brief access the arrays memory directly, elements are in column-major order
+            /// @returns pointer to first element, invalidated if the array is resized or garbage collected
+            Value_t* data() requires IsJuliaBits<Value_t>;
+
+            /// @brief access the arrays memory directly, elements are in column-major order
+            /// @returns const pointer to first element, invalidated if the array is resized or garbage collected
+            const Value_t* data() const requires IsJuliaBits<Value_t>;
+
         protected:
             using Proxy<State>::_content;
 
@@ -220,6 +233,10 @@ namespace jluna
             /// @param symbol
             Vector(jl_value_t* value, jl_sym_t* = nullptr);
 
+            /// @brief ctor sharing the content of another proxy, used when downcasting
+            /// @param content
+            explicit Vector(const std::shared_ptr<typename Proxy<State>::ProxyValue>& content);
+
             /// @brief insert
             /// @param linear index, 0-based
             /// @param value
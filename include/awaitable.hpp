@@ -0,0 +1,54 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 21.02.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <coroutine>
+#include <optional>
+#include <exception>
+#include <functional>
+
+#include <state.hpp>
+#include <proxy.hpp>
+
+namespace jluna
+{
+    /// @brief awaitable julia function call, co_await'ing it runs the call as a julia task and suspends the coroutine until the task is done
+    /// @tparam Return_t: type the result will be unboxed to, if Proxy<State>, the result will be held by an unnamed proxy instead
+    /// @note the coroutine is resumed by whichever julia thread ran the task, so code after the co_await runs on that thread, inside julia. It must not block, for example on a future, mutex or another julia task, as this stalls the julia thread and may deadlock the garbage collector. Hand blocking work to a C++ thread instead
+    template<typename Return_t = Proxy<State>>
+    class Awaitable
+    {
+        public:
+            /// @brief ctor, the call is not scheduled until the awaitable is co_await'ed
+            /// @param function
+            /// @param spawn: if true, the task may run on any thread of julias thread pool, otherwise it is bound to the calling thread
+            /// @param arguments
+            template<typename... Args_t>
+            Awaitable(jl_function_t*, bool spawn, Args_t&&...);
+
+            /// @brief never ready before being scheduled
+            /// @returns false
+            bool await_ready() const noexcept;
+
+            /// @brief schedule the task, the coroutine is resumed on the julia thread that ran it once it finished
+            /// @param handle: handle of the suspended coroutine
+            void await_suspend(std::coroutine_handle<> handle);
+
+            /// @brief access result of the task
+            /// @returns result as Return_t
+            /// @exceptions if an exception occurred julia-side, a JuliaException will be thrown
+            Return_t await_resume();
+
+        private:
+            std::function<void(std::function<void(jl_value_t*)>&&)> _schedule;
+
+            using Result_t = std::conditional_t<std::is_same_v<Return_t, void>, bool, std::optional<Return_t>>;
+            Result_t _result;
+            std::exception_ptr _exception = nullptr;
+    };
+}
+
+#include ".src/awaitable.inl"
@@ -0,0 +1,70 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 05.02.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <julia.h>
+#include <proxy.hpp>
+
+namespace jluna
+{
+    /// @brief non-owning proxy, holds a raw pointer to a julia-side value and never touches the reference table
+    /// @note only valid while the value is kept alive by a caller-provided root, e.g. a Proxy or Frame. Values not reachable from that root, such as boxed isbits fields, are only valid until the next interaction with julia and should be unboxed immediately
+    template<typename State_t>
+    class BorrowedProxy
+    {
+        public:
+            /// @brief ctor
+            /// @param value: already rooted value
+            BorrowedProxy(jl_value_t* value);
+
+            /// @brief ctor, borrow value of proxy
+            /// @param proxy: owner, needs to outlive the borrowed proxy
+            BorrowedProxy(Proxy<State_t>& proxy);
+
+            /// @brief access field
+            /// @param field_name
+            /// @returns field as borrowed proxy
+            BorrowedProxy<State_t> operator[](const std::string& field) const;
+
+            /// @brief access via linear index, if array type returns getindex! result
+            /// @param index
+            /// @returns element as borrowed proxy
+            BorrowedProxy<State_t> operator[](size_t) const;
+
+            /// @brief cast to jl_value_t
+            operator jl_value_t*() const;
+
+            /// @brief cast to string using julias Base.string
+            operator std::string() const;
+
+            /// @brief implicitly convert to T via unboxing
+            /// @returns value as T
+            template<Unboxable T, std::enable_if_t<not std::is_same_v<T, std::string>, bool> = true>
+            operator T() const;
+
+            /// @brief call with any arguments
+            /// @tparams Args_t: types of arguments, need to be boxable
+            /// @returns result as owning proxy, as it is not reachable from the borrowed value
+            template<Boxable... Args_t>
+            auto call(Args_t&&...) const;
+
+            /// @brief call with any arguments and exception forwarding
+            /// @tparams Args_t: types of arguments, need to be boxable
+            /// @returns result as owning proxy, as it is not reachable from the borrowed value
+            template<Boxable... Args_t>
+            auto safe_call(Args_t&&...) const;
+
+            /// @brief call with arguments and exception forwarding, if proxy is a callable function
+            /// @tparams Args_t: types of arguments, need to be boxable
+            template<Boxable... Args_t>
+            auto operator()(Args_t&&...) const;
+
+        private:
+            jl_value_t* _value;
+    };
+}
+
+#include ".src/borrowed_proxy.inl"
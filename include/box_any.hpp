@@ -7,6 +7,7 @@
 
 #include <julia.h>
 #include <.src/common.hpp>
+#include <typedefs.hpp>
 #include <type_traits>
 
 namespace jluna
@@ -91,6 +92,17 @@ namespace jluna
         std::enable_if_t<std::is_same_v<T, std::vector<U>>, bool> = true>
     jl_value_t* box(T);
 
+    /// @brief move vector of isbits values into julia without copying, julia takes ownership of its memory, see adopt
+    template<IsJuliaBits T> requires (not std::is_same_v<T, Bool>)
+    jl_value_t* box(std::vector<T>&&);
+
+    template<IsJuliaBits T>
+    class allocator;
+
+    /// @brief box vector using jluna::allocator, the julia-side vector shares its memory, see allocator
+    template<IsJuliaBits T>
+    jl_value_t* box(const std::vector<T, allocator<T>>&);
+
     /// @brief box to pair
     template<typename T,
         typename T1 = typename T::first_type,
@@ -0,0 +1,97 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 23.02.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+
+#include <typedefs.hpp>
+#include <state.hpp>
+#include <box_any.hpp>
+#include <unbox_any.hpp>
+
+namespace jluna
+{
+    /// @brief bounded lock-free ring buffer that julia sees as an AbstractChannel. Any number of C++ threads and julia tasks may push and pop concurrently
+    /// @tparam T: value type, if T has a julia isbits equivalent, values are stored without boxing. Otherwise they are boxed into rooted julia-side slots, in which case C++ threads calling push or pop need to be known to julia
+    /// @note the julia-side channel refers to memory owned by the C++ object, it may not be used after the C++ object was destroyed
+    template<typename T>
+    class Channel
+    {
+        public:
+            /// @brief ctor
+            /// @param capacity: maximum number of values held at once, rounded up to the next power of 2
+            Channel(size_t capacity);
+
+            /// @brief dtor, closes channel and releases julia-side channel
+            ~Channel();
+
+            /// @brief copy ctor deleted, julia holds pointers into the channel
+            Channel(const Channel&) = delete;
+
+            /// @brief copy assignment deleted, julia holds pointers into the channel
+            Channel& operator=(const Channel&) = delete;
+
+            /// @brief push without blocking
+            /// @param value
+            /// @returns false if the channel is full or closed, true otherwise
+            bool try_push(const T&);
+
+            /// @brief pop without blocking
+            /// @param out: assigned the value, if any
+            /// @returns false if the channel is empty, true otherwise
+            bool try_pop(T& out);
+
+            /// @brief push, yield the calling thread while the channel is full
+            /// @param value
+            /// @returns false if the channel is closed, true otherwise
+            bool push(const T&);
+
+            /// @brief pop, yield the calling thread while the channel is empty
+            /// @returns value or std::nullopt once the channel is closed and empty
+            std::optional<T> pop();
+
+            /// @brief close channel, no more values can be pushed from either side. Remaining values can still be popped
+            void close();
+
+            /// @brief check whether channel was closed from either side
+            /// @returns true if closed, false otherwise
+            bool is_closed() const;
+
+            /// @brief get capacity
+            /// @returns number of slots, power of 2
+            size_t capacity() const;
+
+            /// @brief access julia-side channel, a jluna.channel_handler.RingChannel
+            /// @returns pointer to channel, rooted as long as this object is alive
+            operator jl_value_t*();
+
+        private:
+            static constexpr bool _is_bits = IsJuliaBits<T>;
+
+            static constexpr size_t _enqueue_index = 0;
+            static constexpr size_t _dequeue_index = 8;
+            static constexpr size_t _closed_index = 16;
+
+            static size_t round_capacity(size_t);
+
+            size_t _mask;
+
+            // shared with julia, each position on its own cache line
+            alignas(64) std::atomic<uint64_t> _positions[24];
+            std::unique_ptr<std::atomic<uint64_t>[]> _sequences;
+            std::unique_ptr<T[]> _values = nullptr;    // isbits only
+
+            jl_value_t* _channel = nullptr;
+            jl_array_t* _slots = nullptr;              // non-isbits only
+            size_t _channel_key = 0;
+
+            static_assert(std::atomic<uint64_t>::is_always_lock_free and sizeof(std::atomic<uint64_t>) == sizeof(uint64_t));
+    };
+}
+
+#include ".src/channel.inl"
@@ -0,0 +1,50 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 04.03.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <julia.h>
+#include <vector>
+
+#include <typedefs.hpp>
+#include <.src/common.hpp>
+#include <exceptions.hpp>
+
+namespace jluna
+{
+    /// @brief convert elements between any two types with a julia isbits equivalent, in bulk. Follows the semantics of julias Base.convert: conversions to floating point types round, conversions to integers or Bool require the value to be representable exactly
+    /// @param in: pointer to first element to convert
+    /// @param out: pointer to first element of the result, may not overlap with in unless From and To are the same type
+    /// @param n: number of elements
+    /// @returns true if all elements were converted, false if at least one element is not representable as To, in which case out is left unmodified
+    template<IsJuliaBits From, IsJuliaBits To>
+    bool convert_elements(const From* in, To* out, size_t n);
+
+    /// @brief box values into a julia-side Vector{To}, converting them in bulk
+    /// @param data: pointer to first value
+    /// @param n: number of values
+    /// @returns julia-side vector, unrooted
+    /// @exceptions if a value is not representable as To, a JuliaException wrapping julias InexactError will be thrown
+    template<IsJuliaBits To, IsJuliaBits From>
+    jl_value_t* box_as(const From* data, size_t n);
+
+    /// @brief box vector into a julia-side Vector{To}, converting its values in bulk
+    /// @param vector
+    /// @returns julia-side vector, unrooted
+    /// @exceptions if a value is not representable as To, a JuliaException wrapping julias InexactError will be thrown
+    template<IsJuliaBits To, IsJuliaBits From>
+        requires (not std::is_same_v<From, Bool>)
+    jl_value_t* box_as(const std::vector<From>&);
+
+    namespace detail
+    {
+        /// @brief convert elements of a julia-side array of any isbits type jluna has an equivalent for
+        /// @returns false if the element type of the array has no equivalent or an element is not representable as To
+        template<IsJuliaBits To>
+        bool convert_elements(jl_array_t* in, To* out);
+    }
+}
+
+#include ".src/conversion.inl"
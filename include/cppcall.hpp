@@ -6,69 +6,93 @@
 #pragma once
 
 #include <julia.h>
+#include <atomic>
 #include <typedefs.hpp>
 #include <.src/common.hpp>
+#include <gc_region.hpp>
 
 namespace jluna
 {
     namespace detail
     {
-        static inline size_t _internal_function_id_name = 0;
+        static inline std::atomic<size_t> _internal_function_id_name = 0;
 
         /// @brief forward lambda returning void as jl_nothing
+        /// @param gc_safe: should the lambda be run inside a GCSafeRegion
         /// @param func: lambda
         /// @param args: arguments
         template<typename Lambda_t, typename Return_t, typename... Args_t, std::enable_if_t<std::is_same_v<Return_t, void>, Bool> = true>
-        jl_value_t* invoke_lambda(const Lambda_t* func, Args_t... args);
+        jl_value_t* invoke_lambda(bool gc_safe, const Lambda_t* func, Args_t... args);
 
         /// @brief forward lambda returning jl_value_t* as jl_value_t*
+        /// @param gc_safe: unused, such lambdas are never run inside a GCSafeRegion
         /// @param func: lambda
         /// @param args: arguments
         template<typename Lambda_t, typename Return_t, typename... Args_t, std::enable_if_t<std::is_same_v<Return_t, jl_value_t*>, Bool> = true>
-        jl_value_t* invoke_lambda(const Lambda_t* func, Args_t... args);
+        jl_value_t* invoke_lambda(bool gc_safe, const Lambda_t* func, Args_t... args);
+
+        /// @brief forward lambda returning any other boxable type, the result is boxed after leaving the GCSafeRegion
+        /// @param gc_safe: should the lambda be run inside a GCSafeRegion
+        /// @param func: lambda
+        /// @param args: arguments
+        template<typename Lambda_t, typename Return_t, typename... Args_t, std::enable_if_t<not std::is_same_v<Return_t, void> and not std::is_same_v<Return_t, jl_value_t*>, Bool> = true>
+        jl_value_t* invoke_lambda(bool gc_safe, const Lambda_t* func, Args_t... args);
+
+        /// @brief throw std::invalid_argument if a lambda returning jl_value_t* is registered as gc_safe
+        /// @param name: function name
+        /// @param gc_safe
+        template<typename Return_t>
+        void throw_if_unrooted_result(const std::string& name, bool gc_safe);
     }
 
     /// @brief register lambda with signature void() or jl_value_t*()
     /// @param name: function name
     /// @param lambda
+    /// @param gc_safe: if true, the lambda runs inside a GCSafeRegion and needs to open a GCUnsafeRegion before touching julia values. Lambdas returning jl_value_t* may not be gc_safe
     template<LambdaType<> Lambda_t>
-    void register_function(const std::string& name, const Lambda_t& lambda);
+    void register_function(const std::string& name, const Lambda_t& lambda, bool gc_safe = false);
 
     /// @brief register lambda with signature void(jl_value_t*) or jl_value_t*(jl_value_t*)
     /// @param name: function name
     /// @param lambda
+    /// @param gc_safe: if true, the lambda runs inside a GCSafeRegion and needs to open a GCUnsafeRegion before touching julia values. Lambdas returning jl_value_t* may not be gc_safe
     template<LambdaType<jl_value_t*> Lambda_t>
-    void register_function(const std::string& name, const Lambda_t& lambda);
+    void register_function(const std::string& name, const Lambda_t& lambda, bool gc_safe = false);
 
     /// @brief register lambda with signature void(jl_value_t*, jl_value_t*) or jl_value_t*(jl_value_t*, jl_value_t*)
     /// @param name: function name
     /// @param lambda
+    /// @param gc_safe: if true, the lambda runs inside a GCSafeRegion and needs to open a GCUnsafeRegion before touching julia values. Lambdas returning jl_value_t* may not be gc_safe
     template<LambdaType<jl_value_t*, jl_value_t*> Lambda_t>
-    void register_function(const std::string& name, const Lambda_t& lambda);
+    void register_function(const std::string& name, const Lambda_t& lambda, bool gc_safe = false);
 
     /// @brief register lambda with signature void(3x jl_value_t*) or jl_value_t*(3x jl_value_t*)
     /// @param name: function name
     /// @param lambda
+    /// @param gc_safe: if true, the lambda runs inside a GCSafeRegion and needs to open a GCUnsafeRegion before touching julia values. Lambdas returning jl_value_t* may not be gc_safe
     template<LambdaType<jl_value_t*, jl_value_t*, jl_value_t*> Lambda_t>
-    void register_function(const std::string& name, const Lambda_t& lambda);
+    void register_function(const std::string& name, const Lambda_t& lambda, bool gc_safe = false);
 
     /// @brief register lambda with signature void(4x jl_value_t*) or jl_value_t*(4x jl_value_t*)
     /// @param name: function name
     /// @param lambda
+    /// @param gc_safe: if true, the lambda runs inside a GCSafeRegion and needs to open a GCUnsafeRegion before touching julia values. Lambdas returning jl_value_t* may not be gc_safe
     template<LambdaType<jl_value_t*, jl_value_t*, jl_value_t*, jl_value_t*> Lambda_t>
-    void register_function(const std::string& name, const Lambda_t& lambda);
+    void register_function(const std::string& name, const Lambda_t& lambda, bool gc_safe = false);
 
     /// @brief register lambda with signature void(5x jl_value_t*) or jl_value_t*(5x jl_value_t*)
     /// @param name: function name
     /// @param lambda
+    /// @param gc_safe: if true, the lambda runs inside a GCSafeRegion and needs to open a GCUnsafeRegion before touching julia values. Lambdas returning jl_value_t* may not be gc_safe
     template<LambdaType<jl_value_t*, jl_value_t*, jl_value_t*, jl_value_t*, jl_value_t*> Lambda_t>
-    void register_function(const std::string& name, const Lambda_t& lambda);
+    void register_function(const std::string& name, const Lambda_t& lambda, bool gc_safe = false);
 
     /// @brief register lambda with signature void(std::vector<jl_value_t*>) or jl_value_t*(std::vector<jl_value_t*>)
     /// @param name: function name
     /// @param lambda
+    /// @param gc_safe: if true, the lambda runs inside a GCSafeRegion and needs to open a GCUnsafeRegion before touching julia values. Lambdas returning jl_value_t* may not be gc_safe
     template<LambdaType<std::vector<jl_value_t*>> Lambda_t>
-    void register_function(const std::string& name, const Lambda_t& lambda);
+    void register_function(const std::string& name, const Lambda_t& lambda, bool gc_safe = false);
 }
 
 #include ".src/cppcall.inl"
\ No newline at end of file
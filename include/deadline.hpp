@@ -0,0 +1,68 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 24.02.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <julia.h>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace jluna::detail
+{
+    /// @brief RAII watchdog, interrupts julia via SIGINT if it was not disarmed before the timeout. Used by the deadline-aware call variants, only intended for internal use
+    /// @note only the thread that initialized julia can be interrupted, at most one deadline may be armed at a time
+    class Deadline
+    {
+        public:
+            /// @brief ctor, arms the watchdog. While armed, SIGINT raises an InterruptException rather than exiting
+            /// @param timeout
+            /// @exceptions if called from any thread other than the one that initialized julia, a std::runtime_error is thrown
+            Deadline(std::chrono::nanoseconds timeout);
+
+            /// @brief dtor, disarms the watchdog if that did not already happen and restores the previous handling of SIGINT
+            ~Deadline();
+
+            /// @brief stop the watchdog, has to be called before the result of the guarded call is forwarded
+            /// @returns true if the deadline expired and the interrupt reached the guarded call, false if the call returned first
+            bool disarm();
+
+            /// @brief check whether the last deadline armed by the calling thread expired, then reset
+            /// @param timeout: assigned the timeout of the expired deadline, if any
+            /// @returns true if expired, false otherwise
+            static bool consume_expired(std::chrono::nanoseconds& timeout);
+
+            /// @brief set whether SIGINT exits the process while no deadline is armed, see State::set_exit_on_sigint
+            /// @param on
+            static void set_exit_on_sigint(bool on);
+
+        private:
+            enum Status : uint8_t
+            {
+                ARMED,
+                DISARMED,
+                FIRED
+            };
+
+            std::chrono::nanoseconds _timeout;
+            Status _status = ARMED;
+            bool _joined = false;
+            bool _delivered = false;
+
+            std::mutex _mutex;
+            std::condition_variable _cv;
+            std::thread _watchdog;
+
+            // julia offers no way to query exit_on_sigint, so the value deadlines restore is tracked here. False is julias default when embedded
+            static inline std::atomic<bool> _exit_on_sigint = false;
+
+            static inline thread_local bool _expired = false;
+            static inline thread_local std::chrono::nanoseconds _expired_timeout;
+    };
+}
+
+#include ".src/deadline.inl"
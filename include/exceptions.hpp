@@ -9,6 +9,7 @@
 #include <string>
 #include <iostream>
 #include <vector>
+#include <chrono>
 
 namespace jluna
 {
@@ -37,7 +38,18 @@ namespace jluna
             std::string _message;
     };
 
+    /// @brief exception raised when a call did not finish before its deadline and was interrupted
+    class TimeoutException : public JuliaException
+    {
+        public:
+            /// @brief ctor
+            /// @param exception: value pointing to the julia-side InterruptException, if it was delivered
+            /// @param timeout: duration the call was allowed to take
+            TimeoutException(jl_value_t* exception, std::chrono::nanoseconds timeout);
+    };
+
     /// @brief if julia exception occurred, forward it to C++
+    /// @note if the last call was interrupted because its deadline expired, a TimeoutException will be thrown instead
     extern void forward_last_exception();
 
     /// @brief exception raised when trying to mutate a proxy pointing to an immutable object
@@ -0,0 +1,71 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 22.02.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <thread>
+#include <future>
+#include <atomic>
+#include <functional>
+#include <type_traits>
+#include <iostream>
+
+#include <state.hpp>
+#include <mpsc_queue.hpp>
+
+namespace jluna
+{
+    /// @brief owns the julia runtime on a dedicated thread. Any other thread may hand it closures, which are executed in batches in the order they were submitted
+    /// @note only one executor may exist, and State::initialize may not have been called before. Julia is shut down when the executor is destroyed, this has to happen before main returns
+    class Executor
+    {
+        public:
+            /// @brief ctor, starts the executor thread and initializes the julia state on it
+            /// @param image: optional path to image
+            /// @param batch_size: maximum number of closures executed between two flushes of the references they released
+            /// @exceptions if initializing the julia state throws on the executor thread, the exception is rethrown here after the thread was joined
+            Executor(const std::string& image = "", size_t batch_size = 256);
+
+            /// @brief dtor, executes all closures still queued, then shuts down julia and joins the executor thread
+            ~Executor();
+
+            /// @brief copy ctor deleted, the executor owns its thread
+            Executor(const Executor&) = delete;
+
+            /// @brief copy assignment deleted, the executor owns its thread
+            Executor& operator=(const Executor&) = delete;
+
+            /// @brief queue closure to be executed on the executor thread, may be called from any thread
+            /// @param lambda: any callable with signature () -> T
+            /// @returns future holding the result of the closure, or the exception it threw
+            template<typename Lambda_t>
+            std::future<std::invoke_result_t<Lambda_t>> execute(Lambda_t&& lambda);
+
+            /// @brief queue closure to be executed on the executor thread without waiting for its result, may be called from any thread
+            /// @param lambda: any callable with signature () -> void
+            /// @note exceptions thrown by the closure are printed to std::cerr and otherwise ignored
+            template<typename Lambda_t>
+            void post(Lambda_t&& lambda);
+
+            /// @brief check whether the calling thread is the executor thread
+            /// @returns true if called from within a closure run by the executor, false otherwise
+            bool is_executor_thread() const;
+
+        private:
+            void run();
+            void notify();
+
+            MPSCQueue<std::function<void()>> _queue;
+            size_t _batch_size;
+
+            // incremented every time a closure is pushed or the executor is asked to stop, the executor sleeps on it while idle
+            std::atomic<size_t> _signal = 0;
+            std::atomic<bool> _running = true;
+
+            std::thread _thread;
+    };
+}
+
+#include ".src/executor.inl"
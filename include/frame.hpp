@@ -0,0 +1,31 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 04.02.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <state.hpp>
+
+namespace jluna
+{
+    /// @brief RAII region, every proxy constructed while a frame is alive is rooted in a single julia-side Vector{Any} instead of the reference table. All of them are released at once when the frame is destroyed
+    /// @note proxies that should outlive the frame need to be moved out of it via Proxy::promote
+    class Frame
+    {
+        public:
+            /// @brief ctor, opens frame
+            Frame();
+
+            /// @brief dtor, releases all values rooted in the frame. Never throws, julia-side errors are printed to std::cerr
+            ~Frame() noexcept;
+
+            /// @brief copy ctor deleted, frames are bound to their scope
+            Frame(const Frame&) = delete;
+
+            /// @brief copy assignment deleted, frames are bound to their scope
+            Frame& operator=(const Frame&) = delete;
+    };
+}
+
+#include ".src/frame.inl"
@@ -0,0 +1,54 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 25.02.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <julia.h>
+
+namespace jluna
+{
+    /// @brief RAII region, while alive the calling thread is GC-safe: other threads may collect garbage without waiting for it
+    /// @note inside the region, julia may not be called and no julia value may be allocated or mutated. Data of values that stay rooted elsewhere, such as arguments handed to a cppcall lambda, may still be read
+    class GCSafeRegion
+    {
+        public:
+            /// @brief ctor, enters GC-safe state
+            GCSafeRegion();
+
+            /// @brief dtor, restores previous state, waits for a running collection to finish if necessary
+            ~GCSafeRegion();
+
+            /// @brief copy ctor deleted, regions are bound to their scope
+            GCSafeRegion(const GCSafeRegion&) = delete;
+
+            /// @brief copy assignment deleted, regions are bound to their scope
+            GCSafeRegion& operator=(const GCSafeRegion&) = delete;
+
+        private:
+            int8_t _state;
+    };
+
+    /// @brief RAII region, re-enters GC-unsafe state inside a GCSafeRegion, so julia may be used again while it is alive
+    class GCUnsafeRegion
+    {
+        public:
+            /// @brief ctor, enters GC-unsafe state, waits for a running collection to finish if necessary
+            GCUnsafeRegion();
+
+            /// @brief dtor, restores previous state
+            ~GCUnsafeRegion();
+
+            /// @brief copy ctor deleted, regions are bound to their scope
+            GCUnsafeRegion(const GCUnsafeRegion&) = delete;
+
+            /// @brief copy assignment deleted, regions are bound to their scope
+            GCUnsafeRegion& operator=(const GCUnsafeRegion&) = delete;
+
+        private:
+            int8_t _state;
+    };
+}
+
+#include ".src/gc_region.inl"
@@ -0,0 +1,57 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 02.03.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <functional>
+#include <optional>
+
+#include <typedefs.hpp>
+#include <proxy.hpp>
+
+namespace jluna
+{
+    /// @brief C++-side source of values that julia sees as a lazily evaluated iterable. julia pulls values in batches, so C++ is only entered once per batch
+    /// @tparam Value_t: value type, if it has a julia isbits equivalent, values are written into the julia-side buffer without boxing
+    /// @note the julia-side iterable is single-pass and ends once the generator is exhausted or destroyed
+    template<Boxable Value_t>
+    class Generator
+    {
+        public:
+            /// @brief ctor
+            /// @param next: called to produce the next value, returns std::nullopt once exhausted. Only called from the thread iterating julia-side
+            /// @param batch_size: maximum number of values produced per call from julia
+            Generator(std::function<std::optional<Value_t>()>&& next, size_t batch_size = 1024);
+
+            /// @brief ctor, produce a batch at once
+            /// @param fill: called with a buffer and its capacity, writes values into the buffer and returns how many were written. Returns 0 once exhausted
+            /// @param batch_size: capacity of the buffer
+            Generator(std::function<size_t(Value_t*, size_t)>&& fill, size_t batch_size = 1024) requires IsJuliaBits<Value_t>;
+
+            /// @brief dtor, ends julia-side iteration
+            ~Generator();
+
+            /// @brief copy ctor deleted, the generator is registered by identity
+            Generator(const Generator&) = delete;
+
+            /// @brief copy assignment deleted, the generator is registered by identity
+            Generator& operator=(const Generator&) = delete;
+
+            /// @brief cast to julia-side iterable of type jluna.iterator_handler.CppGenerator{T}
+            operator jl_value_t*();
+
+            /// @brief get julia-side iterable
+            /// @returns unnamed proxy
+            Proxy<State> as_proxy();
+
+        private:
+            void create(size_t batch_size);
+
+            size_t _id;
+            Proxy<State> _iterable;
+    };
+}
+
+#include ".src/generator.inl"
@@ -0,0 +1,111 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 03.03.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <type_traits>
+
+#include <typedefs.hpp>
+#include <array_proxy.hpp>
+#include <adopt.hpp>
+
+namespace jluna
+{
+    /// @brief non-owning, typed view of a column-major matrix with BLAS-style leading dimension. Extents and strides follow the conventions of C++23 std::mdspan with std::layout_stride
+    /// @tparam Value_t: element type, may be const-qualified, needs to have a julia isbits equivalent
+    /// @note the view does not keep the viewed memory alive, it is invalidated once the julia-side array is resized or garbage collected
+    template<typename Value_t>
+        requires IsJuliaBits<std::remove_const_t<Value_t>>
+    class MatrixView
+    {
+        public:
+            /// @brief element type
+            using element_type = Value_t;
+
+            /// @brief value type
+            using value_type = std::remove_const_t<Value_t>;
+
+            /// @brief index type
+            using index_type = size_t;
+
+            /// @brief ctor from raw memory
+            /// @param data: pointer to element (0, 0)
+            /// @param n_rows
+            /// @param n_cols
+            /// @param leading_dimension: distance between the first elements of two consecutive columns, at least n_rows. If 0, n_rows is used
+            MatrixView(Value_t* data, size_t n_rows, size_t n_cols, size_t leading_dimension = 0);
+
+            /// @brief ctor from julia-side matrix
+            /// @param array
+            MatrixView(Array<value_type, 2>& array);
+
+            /// @brief access element, no bounds checking
+            /// @param row: 0-based
+            /// @param col: 0-based
+            /// @returns reference to element
+            Value_t& operator()(size_t row, size_t col) const;
+
+            /// @brief access element with bounds checking
+            /// @param row: 0-based
+            /// @param col: 0-based
+            /// @returns reference to element
+            /// @exceptions if row or col is out of range, a std::out_of_range exception will be thrown
+            Value_t& at(size_t row, size_t col) const;
+
+            /// @brief get number of dimensions
+            /// @returns 2
+            static constexpr size_t rank();
+
+            /// @brief get size of dimension
+            /// @param dimension: 0 for rows, 1 for columns
+            /// @returns size
+            size_t extent(size_t dimension) const;
+
+            /// @brief get distance in elements between two consecutive indices of dimension
+            /// @param dimension: 0 for rows, 1 for columns
+            /// @returns 1 for rows, leading dimension for columns
+            size_t stride(size_t dimension) const;
+
+            /// @brief get number of rows
+            size_t n_rows() const;
+
+            /// @brief get number of columns
+            size_t n_cols() const;
+
+            /// @brief get leading dimension, lda in BLAS
+            size_t leading_dimension() const;
+
+            /// @brief get number of elements
+            size_t size() const;
+
+            /// @brief get pointer to element (0, 0)
+            Value_t* data() const;
+
+            /// @brief are the elements of the view contiguous in memory, this is the case if the leading dimension is equal to the number of rows
+            bool is_contiguous() const;
+
+            /// @brief view of a block of the matrix, sharing the leading dimension
+            /// @param row: 0-based index of first row
+            /// @param col: 0-based index of first column
+            /// @param n_rows
+            /// @param n_cols
+            /// @returns view
+            /// @exceptions if the block exceeds the matrix, a std::out_of_range exception will be thrown
+            MatrixView<Value_t> submatrix(size_t row, size_t col, size_t n_rows, size_t n_cols) const;
+
+            /// @brief view of the same memory as julia-side matrix, without copying. If the view is contiguous, the result is a Matrix, otherwise a strided SubArray of a Matrix that includes the padding between columns
+            /// @note the padded parent spans leading_dimension * n_cols elements, so the memory after the last column of the view needs to be addressable
+            /// @returns unnamed proxy, the viewed memory needs to outlive all julia-side references to it
+            Proxy<State> as_julia() const;
+
+        private:
+            Value_t* _data;
+            size_t _n_rows;
+            size_t _n_cols;
+            size_t _leading_dimension;
+    };
+}
+
+#include ".src/matrix_view.inl"
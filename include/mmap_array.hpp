@@ -0,0 +1,29 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 28.02.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <array>
+#include <tuple>
+
+#include <typedefs.hpp>
+#include <array_proxy.hpp>
+
+namespace jluna
+{
+    /// @brief map a file into memory and wrap it as a julia-side array without copying. Any number of processes, jluna or julia, may map the same file at once and will see each others writes
+    /// @tparam Value_t: element type, needs to have a julia isbits equivalent
+    /// @tparam Rank: number of dimensions
+    /// @param path: file to map, use a path in /dev/shm to share memory without touching the disk
+    /// @param dims: size of each dimension
+    /// @param create: if true, the file is created if it does not exist and grown to fit the array, otherwise it has to already be large enough
+    /// @returns unnamed array proxy, the file is unmapped once the julia-side array is garbage collected
+    /// @exceptions if the file cannot be opened or mapped, a JuliaException will be thrown
+    /// @note the file is never truncated or deleted, the caller is responsible for removing it once it is no longer needed
+    template<IsJuliaBits Value_t, size_t Rank>
+    Array<Value_t, Rank> mmap_array(const std::string& path, const std::array<size_t, Rank>& dims, bool create = true);
+}
+
+#include ".src/mmap_array.inl"
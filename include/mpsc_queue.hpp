@@ -0,0 +1,53 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 22.02.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <atomic>
+#include <optional>
+
+namespace jluna
+{
+    /// @brief unbounded queue without locks, any number of threads may push, only a single thread may pop
+    /// @note pushing is wait-free. Popping never blocks, but it is not lock-free: an element only becomes visible once every producer that started pushing before it finished linking its own element, so a producer preempted mid-push delays the consumer until it resumes
+    template<typename T>
+    class MPSCQueue
+    {
+        public:
+            /// @brief ctor
+            MPSCQueue();
+
+            /// @brief dtor, destroys all elements still in the queue
+            ~MPSCQueue();
+
+            /// @brief copy ctor deleted, other threads may hold a reference to the queue
+            MPSCQueue(const MPSCQueue&) = delete;
+
+            /// @brief copy assignment deleted, other threads may hold a reference to the queue
+            MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+            /// @brief add element to the back of the queue, may be called from any thread
+            /// @param value
+            void push(T&&);
+
+            /// @brief remove element from the front of the queue, may only be called from the consumer thread
+            /// @param out: assigned the element, if any
+            /// @returns false if the queue was empty, true otherwise
+            bool try_pop(T& out);
+
+        private:
+            struct Node
+            {
+                std::atomic<Node*> next = nullptr;
+                std::optional<T> value;
+            };
+
+            // producers append at head, consumer removes at tail. tail always points to an already consumed node
+            alignas(64) std::atomic<Node*> _head;
+            alignas(64) Node* _tail;
+    };
+}
+
+#include ".src/mpsc_queue.inl"
@@ -0,0 +1,91 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 04.03.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <span>
+#include <utility>
+#include <type_traits>
+
+#include <typedefs.hpp>
+#include <array_proxy.hpp>
+
+/// @brief algorithms operating on the memory of julia-side arrays directly, without entering julia. They run on all cores using the parallel, vectorized execution policy of the standard library
+/// @note with libstdc++, algorithms only run in parallel if TBB is available, otherwise they are executed vectorized on the calling thread
+namespace jluna::numeric
+{
+    namespace detail
+    {
+        /// @brief type sum accumulates in, integers narrower than 64 bit and Bool are widened to Int64 or UInt64 like julias Base.sum does
+        template<IsJuliaBits Value_t>
+        using sum_t = std::conditional_t<std::is_floating_point_v<Value_t> or sizeof(Value_t) == 8, Value_t,
+                      std::conditional_t<std::is_signed_v<Value_t> or std::is_same_v<Value_t, Bool>, Int64, UInt64>>;
+    }
+
+    /// @brief sum of all elements
+    /// @param array
+    /// @returns sum, 0 if the array is empty. Integers narrower than 64 bit are accumulated as Int64 or UInt64, so the result only wraps where julias Base.sum does
+    template<IsJuliaBits Value_t, size_t Rank>
+    detail::sum_t<Value_t> sum(Array<Value_t, Rank>&);
+
+    /// @brief smallest and largest element
+    /// @param array
+    /// @returns pair of minimum and maximum
+    /// @exceptions if the array is empty, a std::invalid_argument exception will be thrown
+    template<IsJuliaBits Value_t, size_t Rank>
+    std::pair<Value_t, Value_t> minmax(Array<Value_t, Rank>&);
+
+    /// @brief dot product
+    /// @param a
+    /// @param b
+    /// @returns sum of element-wise products
+    /// @exceptions if the arrays differ in length, a std::invalid_argument exception will be thrown
+    template<IsJuliaBits Value_t, size_t Rank>
+    Value_t dot(Array<Value_t, Rank>&, Array<Value_t, Rank>&);
+
+    /// @brief assign value to all elements
+    /// @param array
+    /// @param value
+    template<IsJuliaBits Value_t, size_t Rank>
+    void fill(Array<Value_t, Rank>&, Value_t);
+
+    /// @brief apply function to every element of in, write results to out. The function is called from multiple threads at once
+    /// @param in
+    /// @param out: may be the same as in
+    /// @param function: with signature (In_t) -> Out_t
+    /// @exceptions if the arrays differ in length, a std::invalid_argument exception will be thrown
+    template<IsJuliaBits In_t, IsJuliaBits Out_t, size_t Rank, typename Function_t>
+        requires std::is_invocable_r_v<Out_t, Function_t, In_t>
+    void transform(Array<In_t, Rank>& in, Array<Out_t, Rank>& out, Function_t&& function);
+
+    /// @brief apply function to every element in place. The function is called from multiple threads at once
+    /// @param array
+    /// @param function: with signature (Value_t) -> Value_t
+    template<IsJuliaBits Value_t, size_t Rank, typename Function_t>
+        requires std::is_invocable_r_v<Value_t, Function_t, Value_t>
+    void transform(Array<Value_t, Rank>&, Function_t&& function);
+
+    /// @brief sort elements in ascending order, in column-major order for arrays of rank > 1
+    /// @param array
+    /// @note unlike julias Base.sort, NaN values are not supported
+    template<IsJuliaBits Value_t, size_t Rank>
+    void sort(Array<Value_t, Rank>&);
+
+    /// @brief sort elements using comparator
+    /// @param array
+    /// @param comparator: with signature (Value_t, Value_t) -> bool, strict weak ordering
+    template<IsJuliaBits Value_t, size_t Rank, typename Comparator_t>
+        requires std::is_invocable_r_v<bool, Comparator_t, Value_t, Value_t>
+    void sort(Array<Value_t, Rank>&, Comparator_t&& comparator);
+
+    /// @brief convert every element of in to the value type of out, using static_cast
+    /// @param in
+    /// @param out
+    /// @exceptions if the arrays differ in length, a std::invalid_argument exception will be thrown
+    template<IsJuliaBits In_t, IsJuliaBits Out_t, size_t Rank>
+    void convert(Array<In_t, Rank>& in, Array<Out_t, Rank>& out);
+}
+
+#include ".src/numeric.inl"
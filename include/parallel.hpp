@@ -0,0 +1,55 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 26.02.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <proxy.hpp>
+#include <array_proxy.hpp>
+#include <cppcall.hpp>
+
+namespace jluna
+{
+    /// @brief apply a julia function to every element of an array, the array is split into chunks which are spawned onto julias thread pool
+    /// @tparam Return_t: value type of the resulting array
+    /// @param function: proxy to any callable julia object
+    /// @param array
+    /// @param n_chunks: number of chunks, if 0, 4 chunks per julia thread
+    /// @returns array of the same shape holding the results
+    /// @exceptions if an error occurs julia-side, a JuliaException will be thrown
+    template<Boxable Return_t = Any, Boxable Value_t, size_t Rank>
+    Array<Return_t, Rank> parallel_map(Proxy<State>& function, Array<Value_t, Rank>& array, size_t n_chunks = 0);
+
+    /// @brief apply a C++ lambda to every element of an array, the array is split into chunks which are spawned onto julias thread pool
+    /// @tparam Return_t: value type of the resulting array
+    /// @param lambda: lambda with signature (jl_value_t*) -> jl_value_t* or (jl_value_t*) -> T, where T is boxable. It will be called from multiple threads at once
+    /// @param array
+    /// @param n_chunks: number of chunks, if 0, 4 chunks per julia thread
+    /// @param gc_safe: should the lambda run in a GCSafeRegion, see register_function
+    /// @returns array of the same shape holding the results
+    /// @exceptions if an error occurs julia-side, a JuliaException will be thrown
+    template<Boxable Return_t = Any, LambdaType<jl_value_t*> Lambda_t, Boxable Value_t, size_t Rank>
+        requires (not std::is_base_of_v<Proxy<State>, Lambda_t>)
+    Array<Return_t, Rank> parallel_map(const Lambda_t& lambda, Array<Value_t, Rank>& array, size_t n_chunks = 0, bool gc_safe = false);
+
+    /// @brief call a julia function on every element of an array for its side effects, the array is split into chunks which are spawned onto julias thread pool
+    /// @param function: proxy to any callable julia object
+    /// @param array
+    /// @param n_chunks: number of chunks, if 0, 4 chunks per julia thread
+    /// @exceptions if an error occurs julia-side, a JuliaException will be thrown
+    template<Boxable Value_t, size_t Rank>
+    void parallel_for(Proxy<State>& function, Array<Value_t, Rank>& array, size_t n_chunks = 0);
+
+    /// @brief call a C++ lambda on every element of an array, the array is split into chunks which are spawned onto julias thread pool
+    /// @param lambda: lambda with signature (jl_value_t*) -> void. It will be called from multiple threads at once
+    /// @param array
+    /// @param n_chunks: number of chunks, if 0, 4 chunks per julia thread
+    /// @param gc_safe: should the lambda run in a GCSafeRegion, see register_function
+    /// @exceptions if an error occurs julia-side, a JuliaException will be thrown
+    template<LambdaType<jl_value_t*> Lambda_t, Boxable Value_t, size_t Rank>
+        requires (not std::is_base_of_v<Proxy<State>, Lambda_t>)
+    void parallel_for(const Lambda_t& lambda, Array<Value_t, Rank>& array, size_t n_chunks = 0, bool gc_safe = false);
+}
+
+#include ".src/parallel.inl"
@@ -9,6 +9,8 @@
 
 #include <memory>
 #include <deque>
+#include <future>
+#include <chrono>
 
 #include <box_any.hpp>
 #include <unbox_any.hpp>
@@ -44,12 +46,22 @@ namespace jluna
             /// @param symbol
             Proxy(jl_value_t* value, jl_sym_t* symbol = nullptr);
 
-            /// @brief construct with no owner, reserved for global temporaries and main
+            /// @brief construct as field of owner
             /// @param value
             /// @param owner: shared pointer to owner, get's incremented
-            /// @param symbol
+            /// @param symbol: name of the field, or nullptr for an unnamed value that only shares the owners lifetime
             Proxy(jl_value_t* value, std::shared_ptr<ProxyValue>& owner, jl_sym_t* symbol);
 
+            /// @brief construct as element of owner
+            /// @param value
+            /// @param owner: shared pointer to owner, get's incremented
+            /// @param index: linear index into owner, 0-based
+            Proxy(jl_value_t* value, std::shared_ptr<ProxyValue>& owner, size_t index);
+
+            /// @brief construct sharing the content of another proxy, no new reference is created
+            /// @param content
+            explicit Proxy(const std::shared_ptr<ProxyValue>& content);
+
             /// @brief dtor
             ~Proxy() = default;
 
@@ -117,6 +129,29 @@ namespace jluna
             template<Boxable... Args_t>
             auto safe_call(Args_t&&...);
 
+            /// @brief call with any arguments, exception forwarding and a deadline
+            /// @param timeout: if the call does not finish within this duration, it is interrupted
+            /// @tparams Args_t: types of arguments, need to be boxable
+            /// @exceptions if the deadline expired, a TimeoutException will be thrown
+            /// @note may only be called from the thread that initialized julia
+            template<typename Rep_t, typename Period_t, Boxable... Args_t>
+            auto safe_call_for(std::chrono::duration<Rep_t, Period_t> timeout, Args_t&&...);
+
+            /// @brief call as a task on julias thread pool, returns immediately
+            /// @tparams Return_t: type the result will be unboxed to, unnamed proxy by default
+            /// @tparams Args_t: types of arguments, need to be boxable
+            /// @returns future holding the result or a JuliaException
+            /// @note if julia runs on a single thread, the task only progresses while that thread is inside julia, wait on the future through State::poll or State::run_for
+            template<typename Return_t = Proxy<State>, Boxable... Args_t>
+            std::future<Return_t> call_async(Args_t&&...);
+
+            /// @brief call as a task on julias thread pool once the result is co_await'ed
+            /// @tparams Return_t: type the result will be unboxed to, unnamed proxy by default
+            /// @tparams Args_t: types of arguments, need to be boxable
+            /// @returns awaitable, the proxy has to stay alive until it was awaited
+            template<typename Return_t = Proxy<State>, Boxable... Args_t>
+            Awaitable<Return_t> call_awaitable(Args_t&&...);
+
             /// call with arguments and exception forwarding, if proxy is a callable function
             /// @tparams Args_t: types of arguments, need to be boxable
             template<Boxable... Args_t>
@@ -144,7 +179,25 @@ namespace jluna
             /// @brief update value if proxy symbol was reassigned outside of operator=
             void update();
 
+            /// @brief move value and all its owners out of the enclosing frame into the reference table, the proxy may then outlive the frame
+            void promote();
+
         protected:
+            /// @brief single step of the path from a root value to the proxy
+            struct PathSegment
+            {
+                enum Kind : uint8_t
+                {
+                    ROOT,   // unnamed value, path starts here
+                    FIELD,  // field or variable of owner
+                    INDEX   // element of owner
+                };
+
+                Kind kind = ROOT;
+                jl_sym_t* field = nullptr;
+                size_t index = 0;
+            };
+
             class ProxyValue
             {
                 friend class Proxy<State_t>;
@@ -152,6 +205,7 @@ namespace jluna
                 public:
                     ProxyValue(jl_value_t*, jl_sym_t*);
                     ProxyValue(jl_value_t*, std::shared_ptr<ProxyValue>& owner, jl_sym_t*);
+                    ProxyValue(jl_value_t*, std::shared_ptr<ProxyValue>& owner, size_t index);
                     ~ProxyValue();
 
                     jl_value_t* get_field(jl_sym_t*);
@@ -159,26 +213,33 @@ namespace jluna
                     std::shared_ptr<ProxyValue> _owner;
 
                     jl_value_t* value();
-                    jl_value_t* symbol();
-
                     size_t value_key();
-                    size_t symbol_key();
 
                     const jl_value_t* value() const;
-                    const jl_value_t* symbol() const;
 
+                    void set_value(jl_value_t*);
+                    void promote();
+
+                    const PathSegment _segment;
                     const bool _is_mutating = true;
 
                 private:
-                    size_t _symbol_key;
-                    size_t _value_key;
+                    void root(jl_value_t*, bool allow_frame = true);
 
-                    jl_value_t* _symbol_ref;
-                    jl_value_t* _value_ref;
+                    // immortal values are held directly in _value_ref, without reference
+                    bool _is_immortal = false;
+                    bool _in_frame = false;
+                    size_t _value_key = 0;
+                    jl_value_t* _value_ref = nullptr;
             };
 
             std::shared_ptr<ProxyValue> _content;
-            std::deque<jl_sym_t*> assemble_name() const;
+
+            /// @brief collect all values from the innermost unnamed root to this proxy
+            std::deque<const ProxyValue*> collect_path() const;
+
+            /// @brief collect arguments for memory_handler.assign and evaluate: root value, then one Symbol or Int64 per segment
+            std::vector<jl_value_t*> assemble_path() const;
     };
 }
 
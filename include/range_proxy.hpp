@@ -0,0 +1,114 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 03.03.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <iterator>
+
+#include <typedefs.hpp>
+#include <proxy.hpp>
+
+namespace jluna
+{
+    /// @brief proxy of any julia-side AbstractRange, elements are computed C++-side from first element and step without accessing julia
+    /// @tparam Value_t: type elements are converted to, needs to have a julia isbits equivalent
+    /// @note for floating point ranges, julia computes elements with extended precision, so elements may differ in the last bit
+    template<IsJuliaBits Value_t>
+    class Range : public Proxy<State>
+    {
+        class Iterator;
+
+        public:
+            /// @brief value type
+            using value_type = Value_t;
+
+            /// @brief ctor
+            /// @param value
+            /// @param owner
+            /// @param symbol
+            /// @exceptions if value is not a range, a JuliaException will be thrown
+            Range(jl_value_t* value, std::shared_ptr<typename Proxy<State>::ProxyValue>&, jl_sym_t*);
+
+            /// @brief ctor unowned proxy
+            /// @param value
+            /// @param name or nullptr
+            /// @exceptions if value is not a range, a JuliaException will be thrown
+            Range(jl_value_t*, jl_sym_t* = nullptr);
+
+            /// @brief ctor sharing the content of another proxy, used when downcasting
+            /// @param content
+            /// @exceptions if value is not a range, a JuliaException will be thrown
+            explicit Range(const std::shared_ptr<typename Proxy<State>::ProxyValue>& content);
+
+            /// @brief compute element, no bounds checking
+            /// @param index: 0-based
+            /// @returns first() + index * step()
+            Value_t operator[](size_t) const;
+
+            /// @brief compute element with bounds checking
+            /// @param index: 0-based
+            /// @returns first() + index * step()
+            /// @exceptions if index is out of range, a std::out_of_range exception will be thrown
+            Value_t at(size_t) const;
+
+            /// @brief get first element
+            Value_t first() const;
+
+            /// @brief get distance between two consecutive elements
+            Value_t step() const;
+
+            /// @brief get last element
+            Value_t last() const;
+
+            /// @brief get number of elements
+            size_t size() const;
+
+            /// @brief is empty
+            bool empty() const;
+
+            /// @brief get iterator to first element
+            Iterator begin() const;
+
+            /// @brief get iterator to past-the-end element
+            Iterator end() const;
+
+        private:
+            void read_layout();
+
+            Value_t _first;
+            Value_t _step;
+            size_t _size;
+
+            class Iterator
+            {
+                public:
+                    using value_type = Value_t;
+                    using difference_type = std::ptrdiff_t;
+
+                    /// @brief ctor
+                    /// @param index
+                    /// @param owner
+                    Iterator(size_t, const Range<Value_t>*);
+
+                    /// @brief compute element
+                    Value_t operator*() const;
+
+                    /// @brief increment
+                    Iterator& operator++();
+
+                    /// @brief post-fix increment
+                    Iterator operator++(int);
+
+                    /// @brief equality operator
+                    bool operator==(const Iterator&) const;
+
+                private:
+                    size_t _index;
+                    const Range<Value_t>* _owner;
+            };
+    };
+}
+
+#include ".src/range_proxy.inl"
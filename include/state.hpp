@@ -8,17 +8,32 @@
 #include <julia.h>
 #include <string>
 #include <deque>
+#include <vector>
 #include <map>
 #include <set>
 #include <.test/test.hpp>
 #include <unordered_map>
 #include <functional>
+#include <mutex>
+#include <future>
+#include <chrono>
 
 namespace jluna
 {
     template<typename>
     class Proxy;
 
+    template<typename>
+    class BorrowedProxy;
+
+    class Frame;
+
+    template<typename>
+    class Awaitable;
+
+    template<typename>
+    class Channel;
+
     /// @brief concept that describes types which can be directly cast to Any
     template<typename T>
     concept Decayable = requires(T t)
@@ -31,6 +46,13 @@ namespace jluna
     {
         template<typename>
         friend class Proxy;
+        template<typename>
+        friend class BorrowedProxy;
+        friend class Frame;
+        template<typename>
+        friend class Awaitable;
+        template<typename>
+        friend class Channel;
         friend class Test;
 
         public:
@@ -70,6 +92,15 @@ namespace jluna
             /// @exceptions if an error occurs julia-side a JuliaException will be thrown
             static auto safe_script(const std::string& command, const std::string& module);
 
+            /// @brief execute line of code with exception handling and a deadline
+            /// @param command
+            /// @param timeout: if the command does not finish within this duration, it is interrupted
+            /// @returns proxy to result, if any
+            /// @exceptions if the deadline expired, a TimeoutException will be thrown. If another error occurs julia-side, a JuliaException will be thrown
+            /// @note may only be called from the thread that initialized julia, which stays usable after the interrupt
+            template<typename Rep_t, typename Period_t>
+            static auto safe_script_for(const std::string& command, std::chrono::duration<Rep_t, Period_t> timeout);
+
             /// @brief access a value, equivalent to unbox<T>(jl_eval_string("return " + name))
             /// @tparam T: type to be unboxed to
             /// @param full name of the value, e.g. Main.variable._field[0]
@@ -89,6 +120,40 @@ namespace jluna
             /// @brief activate/deactivate garbage collector
             static void set_garbage_collector_enabled(bool);
 
+            /// @brief set whether SIGINT terminates the process, use instead of jl_exit_on_sigint, as deadlines restore the value set here once they expire or are disarmed
+            static void set_exit_on_sigint(bool);
+
+            /// @brief release all references queued by free_reference in a single julia-side call
+            /// @note called automatically once the queue reaches _free_queue_threshold and before every garbage collection
+            static void flush_references();
+
+            /// @brief make the calling thread known to julia, has to be called once on every thread other than the one that called initialize before it interacts with julia
+            /// @note threads already known to julia are left untouched
+            /// @note julia-side functions jluna looks up are cached without static initialization guards, so adopted threads never wait on another thread outside of a gc safepoint
+            /// @exceptions if jluna was built against a julia older than 1.9, which cannot adopt threads, a std::runtime_error is thrown
+            static void adopt_thread();
+
+            /// @brief advance the julia event loop and run tasks that are waiting on the calling thread, without blocking
+            /// @param budget: maximum number of tasks to run
+            /// @returns number of tasks that were run
+            /// @note tasks only run when the thread they are bound to calls into julia, use this to let them progress from a C++ host loop
+            static size_t poll(size_t budget = 64);
+
+            /// @brief advance the julia event loop and run tasks on the calling thread for the given duration, timers and I/O callbacks fire while waiting
+            /// @param duration: may be exceeded by up to 1ms
+            template<typename Rep_t, typename Period_t>
+            static void run_for(std::chrono::duration<Rep_t, Period_t> duration);
+
+            /// @brief schedule a julia function call as a task and return immediately
+            /// @tparam Return_t: type the result will be unboxed to, if Proxy<State>, the result will be held by an unnamed proxy instead
+            /// @param function
+            /// @param spawn: if true, the task may run on any thread of julias thread pool, otherwise it is bound to the calling thread
+            /// @param arguments
+            /// @returns future holding the result, if an exception occurs julia-side, the future will hold a JuliaException instead
+            /// @note tasks bound to the calling thread, or all tasks if julia runs on a single thread, only progress while that thread is inside julia. If spawn is false or Threads.nthreads() == 1, calling get() on the future without pumping State::poll or State::run_for blocks forever. Otherwise, get() may block, but should be called inside a GCSafeRegion so the task can trigger garbage collection
+            template<typename Return_t = Proxy<State>, typename... Args_t>
+            static std::future<Return_t> async_call(jl_function_t*, bool spawn, Args_t&&...);
+
         protected:
             /// @brief call julia function without exception forwarding
             /// @param function
@@ -117,23 +182,64 @@ namespace jluna
             /// @note point is used as indexing, therefore it should never be reassigned or a dangling "reference" will be produced
             static size_t create_reference(Any);
 
-            /// @brief remove a value from the safeguard, after the call the garbage collector is free to collect it at any point
+            /// @brief queue a value for removal from the safeguard, once flushed the garbage collector is free to collect it at any point
             /// @param pointer to value
             static void free_reference(size_t);
 
             /// @brief access reference for protected value
             static Any get_reference(size_t);
 
+            /// @brief run a julia function call as a task, then invoke the callback with the result
+            /// @param callback: invoked by whichever julia thread ran the task with a tuple (result, exception, message)
+            /// @param function
+            /// @param spawn: if true, the task may run on any thread of julias thread pool, otherwise it is bound to the calling thread
+            /// @param arguments
+            template<typename... Args_t>
+            static void schedule_call(std::function<void(jl_value_t*)>&& callback, jl_function_t*, bool spawn, Args_t&&...);
+
+            /// @brief convert the tuple handed to a schedule_call callback
+            /// @tparam Return_t: type the result will be unboxed to, if Proxy<State>, the result will be held by an unnamed proxy instead
+            /// @param tuple: (result, exception, message)
+            /// @returns result as Return_t
+            /// @exceptions if the task raised an exception, a JuliaException will be thrown
+            template<typename Return_t>
+            static Return_t unpack_task_result(jl_value_t* tuple);
+
+            /// @brief open a new frame, until the matching pop_frame all proxies are rooted in it instead of the reference table
+            static void push_frame();
+
+            /// @brief close the innermost frame, releasing all values rooted in it at once
+            static void pop_frame() noexcept;
+
+            /// @brief check whether any frame is currently open
+            static bool frame_active();
+
+            /// @brief add a value to the innermost frame
+            /// @param pointer to value
+            /// @returns julia-side Base.RefValue{Any} holding the value, valid until the frame is closed
+            static Any create_frame_reference(Any);
+
         private:
             static inline jl_module_t* _jluna_module = nullptr;
 
             // memory handler interface
             static inline jl_function_t* _create_reference = nullptr;
             static inline jl_function_t* _free_reference = nullptr;
+            static inline jl_function_t* _free_references = nullptr;
             static inline jl_function_t* _force_free = nullptr;
             static inline jl_function_t* _get_value = nullptr;
             static inline jl_function_t* _get_reference = nullptr;
 
+            static inline jl_function_t* _add_to_frame = nullptr;
+
+            // open frames, reference key and julia-side Vector{Any} of each, frames never span threads
+            static inline thread_local std::vector<std::pair<size_t, Any>> _frames = {};
+
+            // keys of references waiting to be freed, shared by all threads
+            static constexpr size_t _free_queue_threshold = 1024;
+            static inline std::vector<size_t> _free_queue = {};
+            static inline std::mutex _free_queue_lock;
+
             // cppcall interface
             static inline jl_function_t* _hash = nullptr;
             std::unordered_map<size_t, std::function<Any()>> _functions;
@@ -0,0 +1,91 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 01.03.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <iterator>
+#include <vector>
+#include <deque>
+
+#include <typedefs.hpp>
+#include <proxy.hpp>
+
+namespace jluna
+{
+    /// @brief single-pass iteration over any julia-side iterable, such as generators, channels, dicts or lazy iterators. Values are pulled in batches, so julia is only entered once per batch
+    /// @tparam Value_t: type values are unboxed to. If it has a julia isbits equivalent, batches are copied without boxing. If Proxy<State>, each value is held by an unnamed proxy
+    template<typename Value_t = Proxy<State>>
+    class Stream
+    {
+        class Iterator;
+
+        public:
+            /// @brief value type
+            using value_type = Value_t;
+
+            /// @brief ctor
+            /// @param iterable: proxy to any object implementing julias iteration interface
+            /// @param batch_size: maximum number of values pulled per call into julia
+            Stream(Proxy<State>& iterable, size_t batch_size = 1024);
+
+            /// @brief copy ctor deleted, iteration state is shared with julia
+            Stream(const Stream&) = delete;
+
+            /// @brief copy assignment deleted, iteration state is shared with julia
+            Stream& operator=(const Stream&) = delete;
+
+            /// @brief get iterator to current value, pulls the first batch if necessary
+            /// @returns input iterator
+            /// @exceptions if an error occurs julia-side, a JuliaException will be thrown
+            Iterator begin();
+
+            /// @brief get sentinel
+            /// @returns sentinel, equal to any iterator that reached the end of the iterable
+            std::default_sentinel_t end() const;
+
+        private:
+            void pull();
+
+            Proxy<State> _stream;
+            size_t _batch_size;
+
+            // std::vector<bool> cannot hand out references
+            std::conditional_t<std::is_same_v<Value_t, Bool>, std::deque<Value_t>, std::vector<Value_t>> _batch;
+            size_t _index = 0;
+            bool _done = false;
+
+            class Iterator
+            {
+                public:
+                    using value_type = Value_t;
+                    using difference_type = std::ptrdiff_t;
+
+                    /// @brief ctor
+                    /// @param owner
+                    Iterator(Stream<Value_t>*);
+
+                    /// @brief access current value
+                    /// @returns reference, invalidated once the iterator is incremented
+                    Value_t& operator*() const;
+
+                    /// @brief advance, pulls next batch if necessary
+                    /// @returns reference to self
+                    /// @exceptions if an error occurs julia-side, a JuliaException will be thrown
+                    Iterator& operator++();
+
+                    /// @brief post-fix advance
+                    void operator++(int);
+
+                    /// @brief compare to sentinel
+                    /// @returns true if end of iterable was reached, false otherwise
+                    bool operator==(std::default_sentinel_t) const;
+
+                private:
+                    Stream<Value_t>* _owner;
+            };
+    };
+}
+
+#include ".src/stream.inl"
@@ -0,0 +1,94 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 03.03.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include <typedefs.hpp>
+#include <proxy.hpp>
+#include <matrix_view.hpp>
+
+namespace jluna
+{
+    /// @brief proxy of any julia-side StridedArray{Value_t, Rank}, such as a SubArray or ReshapedArray of an Array, accessing its memory directly
+    /// @tparam Value_t: element type, needs to have a julia isbits equivalent
+    /// @tparam Rank: number of dimensions
+    /// @note the layout is read once during construction, if the proxy is named and the variable is reassigned, the view needs to be constructed again
+    template<IsJuliaBits Value_t, size_t Rank>
+    class StridedView : public Proxy<State>
+    {
+        public:
+            /// @brief value type
+            using value_type = Value_t;
+
+            /// @brief dimensionality
+            static constexpr size_t rank = Rank;
+
+            /// @brief ctor
+            /// @param value
+            /// @param owner
+            /// @param symbol
+            /// @exceptions if value is not a strided array of matching type and rank, a JuliaException will be thrown
+            StridedView(jl_value_t* value, std::shared_ptr<typename Proxy<State>::ProxyValue>&, jl_sym_t*);
+
+            /// @brief ctor unowned proxy
+            /// @param value
+            /// @param name or nullptr
+            /// @exceptions if value is not a strided array of matching type and rank, a JuliaException will be thrown
+            StridedView(jl_value_t*, jl_sym_t* = nullptr);
+
+            /// @brief ctor sharing the content of another proxy, used when downcasting
+            /// @param content
+            /// @exceptions if value is not a strided array of matching type and rank, a JuliaException will be thrown
+            explicit StridedView(const std::shared_ptr<typename Proxy<State>::ProxyValue>& content);
+
+            /// @brief multi-dimensional indexing, no bounds checking
+            /// @param n integrals, where n is the rank of the array, 0-based
+            /// @returns reference to element
+            template<std::integral... Args>
+                requires (sizeof...(Args) == Rank)
+            Value_t& operator()(Args... indices) const;
+
+            /// @brief linear indexing in column-major order, no bounds checking
+            /// @param index: 0-based
+            /// @returns reference to element
+            Value_t& operator[](size_t) const;
+
+            /// @brief get size of dimension
+            /// @param dimension: 0-based
+            /// @returns size
+            size_t extent(size_t dimension) const;
+
+            /// @brief get distance in elements between two consecutive indices of dimension, may be negative
+            /// @param dimension: 0-based
+            /// @returns stride
+            std::ptrdiff_t stride(size_t dimension) const;
+
+            /// @brief get number of elements
+            size_t size() const;
+
+            /// @brief get pointer to first element
+            Value_t* data() const;
+
+            /// @brief are elements contiguous and in column-major order
+            bool is_contiguous() const;
+
+            /// @brief view as matrix, only possible if elements of each column are contiguous
+            /// @returns matrix view
+            /// @exceptions if stride(0) is not 1 or columns overlap or are in reverse order, a std::invalid_argument exception will be thrown
+            MatrixView<Value_t> as_matrix() const requires (Rank == 2);
+
+        private:
+            void read_layout();
+
+            Value_t* _data;
+            std::array<size_t, Rank> _extents;
+            std::array<std::ptrdiff_t, Rank> _strides;
+    };
+}
+
+#include ".src/strided_view.inl"
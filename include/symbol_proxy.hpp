@@ -25,6 +25,10 @@ namespace jluna
             /// @param symbol of the variable
             Symbol(jl_value_t* value, jl_sym_t* = nullptr);
 
+            /// @brief ctor sharing the content of another proxy, used when downcasting
+            /// @param content
+            explicit Symbol(const std::shared_ptr<typename Proxy<State>::ProxyValue>& content);
+
             /// @brief convert to string
             /// @returns string
             explicit operator std::string() const override;
@@ -0,0 +1,49 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 02.03.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <span>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <typedefs.hpp>
+#include <proxy.hpp>
+
+namespace jluna
+{
+    /// @brief named, contiguous column of a C++-side table
+    template<typename T>
+    struct Column
+    {
+        /// @brief name of the column, julia-side name of the NamedTuple field
+        std::string name;
+
+        /// @brief values, usually a std::vector or a column of a struct-of-arrays
+        std::span<const T> data;
+    };
+
+    /// @brief box columns into a julia-side column table, a NamedTuple of Vectors
+    /// @param columns: need to all be of the same length
+    /// @returns julia-side NamedTuple
+    /// @exceptions if the columns differ in length, a JuliaException will be thrown
+    /// @note columns of a type with a julia isbits equivalent are copied in one piece, all others are boxed element by element
+    template<Boxable... Ts>
+    jl_value_t* box_columns(const Column<Ts>&... columns);
+
+    /// @brief unbox columns of a julia-side table, any object whose columns are accessible through getproperty, such as a NamedTuple of Vectors
+    /// @tparam Ts: value types of the columns, in order
+    /// @param table
+    /// @param names: name of each column, in the same order as Ts
+    /// @returns tuple of vectors, one for each column
+    /// @exceptions if a column does not exist or cannot be converted, a JuliaException will be thrown
+    /// @note columns of a type with a julia isbits equivalent are copied in one piece, all others are unboxed element by element
+    template<Unboxable... Ts, typename... Names_t>
+        requires (sizeof...(Ts) == sizeof...(Names_t) and (std::is_convertible_v<Names_t, std::string> and ...))
+    std::tuple<std::vector<Ts>...> unbox_columns(jl_value_t* table, const Names_t&... names);
+}
+
+#include ".src/table.inl"
@@ -7,6 +7,8 @@
 
 #include <julia.h>
 #include <complex>
+#include <type_traits>
+#include <atomic>
 
 namespace jluna
 {
@@ -29,4 +31,29 @@ namespace jluna
     using Float64 = double;
 
     using Any = jl_value_t*;
-}
\ No newline at end of file
+
+    /// @brief concept: C++ type that has a julia isbits equivalent with identical memory layout
+    template<typename T>
+    concept IsJuliaBits =
+        std::is_same_v<T, Bool> or
+        std::is_same_v<T, Int8> or std::is_same_v<T, Int16> or std::is_same_v<T, Int32> or std::is_same_v<T, Int64> or
+        std::is_same_v<T, UInt8> or std::is_same_v<T, UInt16> or std::is_same_v<T, UInt32> or std::is_same_v<T, UInt64> or
+        std::is_same_v<T, Float32> or std::is_same_v<T, Float64>;
+
+    /// @brief get julia type with the same memory layout as T
+    /// @returns pointer to singleton type
+    template<IsJuliaBits T>
+    jl_datatype_t* to_julia_type();
+
+    namespace detail
+    {
+        /// @brief cache the result of a julia-side lookup, used instead of a function-local static
+        /// @param lookup: lambda returning the pointer to cache, each call site should pass its own lambda
+        /// @returns cached pointer
+        /// @note a function-local static is guarded by a lock that is not a gc safepoint, an adopted thread waiting on it while another thread runs the initializer can deadlock the garbage collector. The cache is constant-initialized and has no guard, racing threads may each run lookup
+        template<typename Lookup_t>
+        auto cached(Lookup_t lookup) -> decltype(lookup());
+    }
+}
+
+#include ".src/typedefs.inl"
@@ -0,0 +1,74 @@
+// 
+// Copyright 2022 Clemens Cords
+// Created on 27.02.22 by clem (mail@clemens-cords.com)
+//
+
+#pragma once
+
+#include <future>
+
+#include <state.hpp>
+#include <proxy.hpp>
+#include <array_proxy.hpp>
+
+namespace jluna
+{
+    /// @brief pool of local julia worker processes, each with its own garbage collector and compiler. Calls are dispatched to the least busy worker
+    /// @note functions called on workers need to be defined on them first, see WorkerPool::script
+    class WorkerPool
+    {
+        public:
+            /// @brief ctor, starts worker processes
+            /// @param n_workers: number of processes
+            WorkerPool(size_t n_workers);
+
+            /// @brief dtor, shuts down all worker processes
+            ~WorkerPool();
+
+            /// @brief copy ctor deleted, the pool owns its processes
+            WorkerPool(const WorkerPool&) = delete;
+
+            /// @brief copy assignment deleted, the pool owns its processes
+            WorkerPool& operator=(const WorkerPool&) = delete;
+
+            /// @brief get number of worker processes
+            /// @returns number
+            size_t size() const;
+
+            /// @brief execute code in Main of this process and of every worker, equivalent to @everywhere
+            /// @param command
+            /// @exceptions if an error occurs julia-side, a JuliaException will be thrown
+            void script(const std::string&);
+
+            /// @brief call function on the least busy worker and wait for the result. Arrays of isbits types with at least 1024 elements are copied into shared memory instead of being serialized
+            /// @note the shared copy is made anew on every call, use WorkerPool::share to copy an array once and hand the result to any number of calls
+            /// @tparam Return_t: type the result will be unboxed to, if Proxy<State>, the result will be held by an unnamed proxy instead
+            /// @param function: proxy to a function defined on all workers
+            /// @param arguments
+            /// @returns result
+            /// @exceptions if an error occurs on the worker, a JuliaException will be thrown
+            template<typename Return_t = Proxy<State>, Boxable... Args_t>
+            Return_t call(Proxy<State>& function, Args_t&&...);
+
+            /// @brief call function on the least busy worker without waiting, see WorkerPool::call
+            /// @tparam Return_t: type the result will be unboxed to, if Proxy<State>, the result will be held by an unnamed proxy instead
+            /// @param function: proxy to a function defined on all workers
+            /// @param arguments
+            /// @returns future holding the result, or a JuliaException if an error occurred on the worker
+            /// @note the call is scheduled as a task on julias thread pool. If julia runs on a single thread, the task only progresses while that thread is inside julia, so wait on the future by calling State::poll or State::run_for rather than blocking in std::future::get
+            template<typename Return_t = Proxy<State>, Boxable... Args_t>
+            std::future<Return_t> call_async(Proxy<State>& function, Args_t&&...);
+
+            /// @brief copy array into shared memory that is mapped by this process and all workers, so it can be handed to any number of calls without being copied again
+            /// @param array: array of isbits type
+            /// @returns proxy to julia-side SharedArrays.SharedArray
+            template<Boxable Value_t, size_t Rank>
+            Proxy<State> share(Array<Value_t, Rank>&);
+
+        private:
+            Proxy<State> _pool;
+            size_t _n_workers;
+    };
+}
+
+#include ".src/worker_pool.inl"
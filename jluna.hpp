@@ -10,10 +10,29 @@
 #include <include/typedefs.hpp>
 #include <include/state.hpp>
 #include <include/proxy.hpp>
+#include <include/borrowed_proxy.hpp>
+#include <include/frame.hpp>
+#include <include/awaitable.hpp>
+#include <include/executor.hpp>
+#include <include/channel.hpp>
 
 #include <include/array_proxy.hpp>
 #include <include/symbol_proxy.hpp>
 #include <include/type_proxy.hpp>
 
 #include <include/exceptions.hpp>
-#include <include/cppcall.hpp>
\ No newline at end of file
+#include <include/cppcall.hpp>
+#include <include/gc_region.hpp>
+#include <include/parallel.hpp>
+#include <include/worker_pool.hpp>
+#include <include/mmap_array.hpp>
+#include <include/adopt.hpp>
+#include <include/allocator.hpp>
+#include <include/stream.hpp>
+#include <include/generator.hpp>
+#include <include/table.hpp>
+#include <include/matrix_view.hpp>
+#include <include/strided_view.hpp>
+#include <include/range_proxy.hpp>
+#include <include/numeric.hpp>
+#include <include/conversion.hpp>
\ No newline at end of file